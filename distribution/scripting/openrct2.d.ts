@@ -501,9 +501,9 @@ declare global {
          */
         subscribe(hook: HookType, callback: Function): IDisposable;
 
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, filter?: ActionHookFilter): IDisposable;
         subscribe(hook: "action.location", callback: (e: ActionLocationArgs) => void): IDisposable;
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, filter?: ActionHookFilter): IDisposable;
         subscribe(hook: "guest.generation", callback: (e: GuestGenerationArgs) => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
@@ -1600,6 +1600,14 @@ declare global {
         height: number;
     }
 
+    interface ActionHookFilter {
+        /**
+         * The actions the callback is called for, which can include custom actions registered by plugins.
+         * The callback is called for all actions if this is not specified or empty.
+         */
+        actions?: (ActionType | string)[];
+    }
+
     interface GameActionEventArgs<T = object> {
         readonly player: number;
         readonly type: number;
@@ -5707,6 +5715,15 @@ declare global {
 
     interface Profiler {
         getData(): ProfiledFunction[];
+        /**
+         * Gets how many events each hook subscription received and how many were skipped by its filter.
+         */
+        getHookData(): ProfiledHook[];
+        /**
+         * Gets the most recent calls of all threads, with frame and tick markers, as JSON in the Chrome trace event
+         * format. The result can be saved to a file and opened in Perfetto or chrome://tracing.
+         */
+        getTrace(): string;
         start(): void;
         stop(): void;
         reset(): void;
@@ -5723,6 +5740,13 @@ declare global {
         readonly children: number[];
     }
 
+    interface ProfiledHook {
+        readonly hook: HookType;
+        readonly plugin: string;
+        readonly delivered: number;
+        readonly skipped: number;
+    }
+
     interface ObjectManager {
         /**
          * Gets all the objects that are installed and can be loaded into the park.
@@ -114,13 +114,18 @@ namespace OpenRCT2::Audio
             {
                 auto source = CreateAudioSource(rw);
 
-                // Load whole stream into memory if small enough
+                // Load whole stream into memory if small enough, otherwise decode and convert it ahead of playback
+                // on a worker thread, keeping that work out of the audio callback.
+                auto& targetFormat = _audioMixer->GetFormat();
                 auto dataLength = source->GetLength();
                 if (dataLength < kStreamMinSize)
                 {
-                    auto& targetFormat = _audioMixer->GetFormat();
                     source = source->ToMemory(targetFormat);
                 }
+                else
+                {
+                    source = CreateStreamingAudioSource(CreateConvertingAudioSource(std::move(source), targetFormat));
+                }
 
                 return AddSource(std::move(source));
             }
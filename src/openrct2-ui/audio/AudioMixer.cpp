@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <iterator>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/audio/AudioMixing.h>
 #include <openrct2/config/Config.h>
 
 using namespace OpenRCT2::Audio;
@@ -175,6 +176,13 @@ void AudioMixer::UpdateAdjustedSound()
 // TODO: investigate replacing this with OpenAL (#26035)
 void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length)
 {
+    // Sources are converted to the output format when they are loaded or decoded, so this is the common case.
+    if (_outputFormat.format == AUDIO_S16SYS && _outputFormat.channels == 2 && channel->GetFormat() == _outputFormat)
+    {
+        MixChannelS16Stereo(channel, data, length);
+        return;
+    }
+
     int32_t outputByteRate = _outputFormat.GetByteRate();
     auto numSamples = static_cast<int32_t>(length / outputByteRate);
     double rate = 1;
@@ -254,6 +262,82 @@ void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t len
     channel->UpdateOldVolume();
 }
 
+void AudioMixer::MixChannelS16Stereo(ISDLAudioChannel* channel, uint8_t* data, size_t length)
+{
+    const int32_t outputByteRate = _outputFormat.GetByteRate();
+    const auto numSamples = static_cast<int32_t>(length / outputByteRate);
+    const double rate = channel->GetRate();
+
+    // Read raw PCM from channel
+    const auto readSamples = static_cast<int32_t>(numSamples * rate);
+    const auto readLength = static_cast<size_t>(readSamples) * outputByteRate;
+    _channelBuffer.resize(readLength);
+    const size_t bytesRead = channel->Read(_channelBuffer.data(), readLength);
+    const auto srcFrames = static_cast<int32_t>(bytesRead / outputByteRate);
+
+    // Use the same resampling ratio as ApplyResample
+    int32_t dstFrames = std::min(numSamples, srcFrames);
+    double ratio = 1;
+    if (rate != 1)
+    {
+        auto inRate = static_cast<double>(srcFrames);
+        auto outRate = static_cast<double>(numSamples);
+        if (bytesRead != readLength)
+        {
+            inRate = _outputFormat.freq;
+            outRate = static_cast<int32_t>(_outputFormat.freq * (1 / rate));
+        }
+        ratio = inRate / outRate;
+        dstFrames = numSamples;
+    }
+
+    // Prevent buffer underread in the interpolation
+    if (srcFrames < 2)
+    {
+        dstFrames = 0;
+    }
+
+    MixGains gains{ 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    if (channel->GetPan() != 0.5f && dstFrames > 0)
+    {
+        // Same ramp as EffectPanS16
+        const float dt = 1.0f / static_cast<float>(dstFrames * 2.0f);
+        gains.panLeft = channel->GetOldVolumeL();
+        gains.panRight = channel->GetOldVolumeR();
+        gains.panLeftStep = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
+        gains.panRightStep = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
+    }
+
+    const float volumeAdjust = GetVolumeAdjust(channel);
+    int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
+    int32_t endVolume = channel->GetVolume() * volumeAdjust;
+    if (channel->IsStopping())
+    {
+        endVolume = 0;
+    }
+
+    if (startVolume != endVolume)
+    {
+        // Fade between volume levels to smooth out sound and minimize clicks from sudden volume changes
+        const int32_t fadeLength = dstFrames * 2;
+        gains.volume = static_cast<float>(startVolume) / SDL_MIX_MAXVOLUME;
+        if (fadeLength > 0)
+        {
+            gains.volumeStep = static_cast<float>(endVolume - startVolume) / SDL_MIX_MAXVOLUME / fadeLength;
+        }
+    }
+    else
+    {
+        gains.volume = static_cast<float>(endVolume) / SDL_MIX_MAXVOLUME;
+    }
+
+    MixResampledS16Stereo(
+        reinterpret_cast<int16_t*>(data), dstFrames, reinterpret_cast<const int16_t*>(_channelBuffer.data()), srcFrames,
+        ratio, gains);
+
+    channel->UpdateOldVolume();
+}
+
 /**
  * Resample the given buffer into _effectBuffer.
  * Assumes that srcBuffer is the same format as _outputFormat.
@@ -327,8 +411,7 @@ void AudioMixer::ApplyPan(const IAudioChannel* channel, void* buffer, size_t len
     }
 }
 
-// TODO: investigate replacing this with OpenAL (#26035)
-int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+float AudioMixer::GetVolumeAdjust(const IAudioChannel* channel) const
 {
     float volumeAdjust = _volume;
     volumeAdjust *= Config::Get().sound.masterSoundEnabled ? (static_cast<float>(Config::Get().sound.masterVolume) / 100.0f)
@@ -350,7 +433,13 @@ int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size
             volumeAdjust *= _adjustMusicVolume;
             break;
     }
+    return volumeAdjust;
+}
 
+// TODO: investigate replacing this with OpenAL (#26035)
+int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+{
+    const float volumeAdjust = GetVolumeAdjust(channel);
     int32_t startVolume = channel->GetOldVolume() * volumeAdjust;
     int32_t endVolume = channel->GetVolume() * volumeAdjust;
     if (channel->IsStopping())
@@ -63,6 +63,7 @@ namespace OpenRCT2::Audio
         void GetNextAudioChunk(uint8_t* dst, size_t length);
         void UpdateAdjustedSound();
         void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length);
+        void MixChannelS16Stereo(ISDLAudioChannel* channel, uint8_t* data, size_t length);
         void RemoveReleasedSources();
 
         /**
@@ -72,6 +73,7 @@ namespace OpenRCT2::Audio
         size_t ApplyResample(const void* srcBuffer, int32_t srcSamples, int32_t dstSamples, int32_t inRate, int32_t outRate);
         void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize);
         int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len);
+        float GetVolumeAdjust(const IAudioChannel* channel) const;
         static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length);
         static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length);
         static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume);
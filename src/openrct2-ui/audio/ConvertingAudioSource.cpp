@@ -0,0 +1,165 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioFormat.h"
+#include "SDLAudioSource.h"
+
+#include <SDL.h>
+#include <algorithm>
+#include <openrct2/Diagnostic.h>
+#include <openrct2/audio/AudioSource.h>
+#include <vector>
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * An audio source which converts a streamed source to another format as it is decoded, so that the mixer
+     * does not have to convert it on every audio callback.
+     */
+    class ConvertingAudioSource final : public SDLAudioSource
+    {
+    private:
+        static constexpr size_t kReadChunkSize = 16 * 1024;
+
+        std::unique_ptr<SDLAudioSource> _source;
+        AudioFormat _srcFormat = {};
+        AudioFormat _format = {};
+        SDL_AudioStream* _stream = nullptr;
+        std::vector<uint8_t> _readBuffer;
+
+        uint64_t _length{};
+        uint64_t _srcOffset{};
+        uint64_t _currentOffset{};
+        bool _flushed{};
+
+    public:
+        ConvertingAudioSource(std::unique_ptr<SDLAudioSource> source, const AudioFormat& target, SDL_AudioStream* stream)
+            : _source(std::move(source))
+            , _srcFormat(_source->GetFormat())
+            , _format(target)
+            , _stream(stream)
+            , _readBuffer(kReadChunkSize)
+        {
+            const uint64_t srcFrames = _source->GetLength() / _srcFormat.GetByteRate();
+            const uint64_t frames = srcFrames * _format.freq / _srcFormat.freq;
+            _length = frames * _format.GetByteRate();
+        }
+
+        ~ConvertingAudioSource() override
+        {
+            Release();
+        }
+
+        [[nodiscard]] AudioFormat GetFormat() const override
+        {
+            return _format;
+        }
+
+        [[nodiscard]] uint64_t GetLength() const override
+        {
+            return _length;
+        }
+
+        size_t Read(void* dst, uint64_t offset, size_t len) override
+        {
+            if (_stream == nullptr)
+                return 0;
+
+            if (_currentOffset != offset)
+            {
+                Seek(offset);
+            }
+
+            const uint64_t srcLength = _source->GetLength();
+            auto* dst8 = static_cast<uint8_t*>(dst);
+            size_t totalBytesRead = 0;
+            while (totalBytesRead < len)
+            {
+                const int available = SDL_AudioStreamAvailable(_stream);
+                if (available > 0)
+                {
+                    const auto toGet = std::min<size_t>(len - totalBytesRead, static_cast<size_t>(available));
+                    const int got = SDL_AudioStreamGet(_stream, dst8 + totalBytesRead, static_cast<int>(toGet));
+                    if (got <= 0)
+                        break;
+
+                    totalBytesRead += got;
+                    continue;
+                }
+
+                if (_srcOffset >= srcLength)
+                {
+                    if (_flushed)
+                        break;
+
+                    // Push out whatever the resampler is still holding on to.
+                    SDL_AudioStreamFlush(_stream);
+                    _flushed = true;
+                    continue;
+                }
+
+                const size_t bytesRead = _source->Read(_readBuffer.data(), _srcOffset, _readBuffer.size());
+                if (bytesRead == 0)
+                {
+                    _srcOffset = srcLength;
+                    continue;
+                }
+
+                _srcOffset += bytesRead;
+                if (SDL_AudioStreamPut(_stream, _readBuffer.data(), static_cast<int>(bytesRead)) != 0)
+                    break;
+            }
+
+            _currentOffset += totalBytesRead;
+            return totalBytesRead;
+        }
+
+    protected:
+        void Unload() override
+        {
+            if (_stream != nullptr)
+            {
+                SDL_FreeAudioStream(_stream);
+                _stream = nullptr;
+            }
+            _source = nullptr;
+        }
+
+    private:
+        void Seek(uint64_t offset)
+        {
+            const uint64_t frame = offset / _format.GetByteRate();
+            const uint64_t srcFrame = frame * _srcFormat.freq / _format.freq;
+            _srcOffset = srcFrame * _srcFormat.GetByteRate();
+            _currentOffset = offset;
+            _flushed = false;
+            SDL_AudioStreamClear(_stream);
+        }
+    };
+
+    std::unique_ptr<SDLAudioSource> CreateConvertingAudioSource(
+        std::unique_ptr<SDLAudioSource> source, const AudioFormat& target)
+    {
+        const auto srcFormat = source->GetFormat();
+        if (srcFormat == target)
+        {
+            return source;
+        }
+
+        auto* stream = SDL_NewAudioStream(
+            srcFormat.format, srcFormat.channels, srcFormat.freq, target.format, target.channels, target.freq);
+        if (stream == nullptr)
+        {
+            // The mixer will fall back to converting the source on every audio callback.
+            LOG_VERBOSE("Unable to create audio stream for conversion: %s", SDL_GetError());
+            return source;
+        }
+        return std::make_unique<ConvertingAudioSource>(std::move(source), target, stream);
+    }
+} // namespace OpenRCT2::Audio
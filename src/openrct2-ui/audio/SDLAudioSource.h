@@ -53,6 +53,9 @@ namespace OpenRCT2::Audio
     std::unique_ptr<SDLAudioSource> CreateAudioSource(SDL_RWops* rw, uint32_t cssIndex);
     std::unique_ptr<SDLAudioSource> CreateMemoryAudioSource(
         const AudioFormat& target, const AudioFormat& src, std::vector<uint8_t>&& pcmData);
+    std::unique_ptr<SDLAudioSource> CreateConvertingAudioSource(
+        std::unique_ptr<SDLAudioSource> source, const AudioFormat& target);
+    std::unique_ptr<SDLAudioSource> CreateStreamingAudioSource(std::unique_ptr<SDLAudioSource> source);
     std::unique_ptr<SDLAudioSource> CreateFlacAudioSource(SDL_RWops* rw);
     std::unique_ptr<SDLAudioSource> CreateOggAudioSource(SDL_RWops* rw);
     std::unique_ptr<SDLAudioSource> CreateWavAudioSource(SDL_RWops* rw);
@@ -0,0 +1,211 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioFormat.h"
+#include "SDLAudioSource.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <openrct2/profiling/Profiling.h>
+#include <thread>
+#include <vector>
+
+namespace OpenRCT2::Audio
+{
+    static Profiling::Counter _streamUnderruns("Audio stream underruns");
+    static Profiling::Counter _streamUnderrunBytes("Audio stream underrun bytes");
+
+    /**
+     * An audio source which decodes a streamed source ahead of playback on a worker thread into a ring buffer, so that
+     * the audio callback only has to copy the decoded data. The worker is started by the first read, so that sources
+     * which are only created to read their length and format never start one.
+     */
+    class StreamingAudioSource final : public SDLAudioSource
+    {
+    private:
+        static constexpr size_t kBufferSize = 512 * 1024;
+        static constexpr size_t kDecodeChunkSize = 16 * 1024;
+
+        std::unique_ptr<SDLAudioSource> _source;
+        AudioFormat _format = {};
+        uint64_t _length{};
+
+        std::mutex _mutex;
+        std::condition_variable _spaceAvailable;
+        std::vector<uint8_t> _buffer;
+        size_t _readPosition{};
+        size_t _bufferedBytes{};
+        // Source offsets of the next byte the channel reads, the first buffered byte and the next byte the worker decodes.
+        // The worker carries on from the start after reaching the end, so looping channels do not have to wait for it.
+        uint64_t _readOffset{};
+        uint64_t _bufferOffset{};
+        uint64_t _decodeOffset{};
+        // Incremented on every seek so that the worker can drop a chunk it decoded for the old position.
+        uint32_t _seekCount{};
+        bool _stopping{};
+        std::thread _worker;
+
+    public:
+        explicit StreamingAudioSource(std::unique_ptr<SDLAudioSource> source)
+            : _source(std::move(source))
+            , _format(_source->GetFormat())
+            , _length(_source->GetLength())
+            , _buffer(kBufferSize)
+        {
+        }
+
+        ~StreamingAudioSource() override
+        {
+            Release();
+
+            // The mixer destroys released sources once they are no longer played, so the worker is joined here rather
+            // than in Unload, which runs with the mixer locked. It stops after decoding at most one more chunk.
+            if (_worker.joinable())
+            {
+                _worker.join();
+            }
+        }
+
+        [[nodiscard]] AudioFormat GetFormat() const override
+        {
+            return _format;
+        }
+
+        [[nodiscard]] uint64_t GetLength() const override
+        {
+            return _length;
+        }
+
+        size_t Read(void* dst, uint64_t offset, size_t len) override
+        {
+            if (offset >= _length)
+                return 0;
+
+            len = static_cast<size_t>(std::min<uint64_t>(len, _length - offset));
+            auto* dst8 = static_cast<uint8_t*>(dst);
+
+            std::unique_lock lock(_mutex);
+            if (_stopping)
+                return 0;
+
+            if (!_worker.joinable())
+            {
+                _worker = std::thread([this] { DecodeLoop(); });
+            }
+            if (offset != _readOffset)
+            {
+                Seek(offset);
+            }
+
+            // Drop whatever was played as silence during an earlier underrun.
+            const auto behind = static_cast<size_t>((_readOffset + _length - _bufferOffset) % _length);
+            Consume(std::min(behind, _bufferedBytes));
+
+            const size_t bytesCopied = std::min(len, _bufferedBytes);
+            const size_t firstPart = std::min(bytesCopied, _buffer.size() - _readPosition);
+            std::memcpy(dst8, _buffer.data() + _readPosition, firstPart);
+            std::memcpy(dst8 + firstPart, _buffer.data(), bytesCopied - firstPart);
+            Consume(bytesCopied);
+            _readOffset = (_readOffset + len) % _length;
+            lock.unlock();
+            _spaceAvailable.notify_one();
+
+            if (bytesCopied < len)
+            {
+                // The worker has fallen behind or has just started or seeked. Play silence rather than blocking the
+                // callback or ending the channel early and skip the same amount of decoded data once it arrives, so
+                // playback stays in time without seeking the decoder.
+                std::memset(dst8 + bytesCopied, _format.format == AUDIO_U8 ? 0x80 : 0, len - bytesCopied);
+                _streamUnderruns.add(1);
+                _streamUnderrunBytes.add(len - bytesCopied);
+            }
+            return len;
+        }
+
+    protected:
+        void Unload() override
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _stopping = true;
+            }
+            _spaceAvailable.notify_all();
+        }
+
+    private:
+        // Must be called with the lock held.
+        void Consume(size_t length)
+        {
+            _readPosition = (_readPosition + length) % _buffer.size();
+            _bufferedBytes -= length;
+            _bufferOffset = (_bufferOffset + length) % _length;
+        }
+
+        // Must be called with the lock held.
+        void Seek(uint64_t offset)
+        {
+            _readPosition = 0;
+            _bufferedBytes = 0;
+            _readOffset = offset;
+            _bufferOffset = offset;
+            _decodeOffset = offset;
+            _seekCount++;
+            _spaceAvailable.notify_one();
+        }
+
+        void DecodeLoop()
+        {
+            // Whole frames only, so that looping does not split a frame between the end and the start of the source.
+            const size_t frameSize = std::max<size_t>(1, _format.GetByteRate());
+            std::vector<uint8_t> chunk((kDecodeChunkSize / frameSize) * frameSize);
+
+            std::unique_lock lock(_mutex);
+            while (!_stopping)
+            {
+                _spaceAvailable.wait(lock, [&] { return _stopping || _buffer.size() - _bufferedBytes >= chunk.size(); });
+                if (_stopping)
+                    break;
+
+                const uint64_t decodeOffset = _decodeOffset;
+                const uint32_t seekCount = _seekCount;
+                lock.unlock();
+
+                const auto toDecode = static_cast<size_t>(std::min<uint64_t>(chunk.size(), _length - decodeOffset));
+                const size_t bytesDecoded = _source->Read(chunk.data(), decodeOffset, toDecode);
+                if (bytesDecoded < toDecode)
+                {
+                    // Keep the buffer in step with the source offsets by playing silence for data that failed to decode.
+                    std::memset(chunk.data() + bytesDecoded, _format.format == AUDIO_U8 ? 0x80 : 0, toDecode - bytesDecoded);
+                }
+
+                lock.lock();
+                if (seekCount != _seekCount)
+                    continue;
+
+                const size_t writePosition = (_readPosition + _bufferedBytes) % _buffer.size();
+                const size_t firstPart = std::min(toDecode, _buffer.size() - writePosition);
+                std::memcpy(_buffer.data() + writePosition, chunk.data(), firstPart);
+                std::memcpy(_buffer.data(), chunk.data() + firstPart, toDecode - firstPart);
+                _bufferedBytes += toDecode;
+                _decodeOffset = (decodeOffset + toDecode) % _length;
+            }
+        }
+    };
+
+    std::unique_ptr<SDLAudioSource> CreateStreamingAudioSource(std::unique_ptr<SDLAudioSource> source)
+    {
+        if (source->GetLength() == 0)
+        {
+            return source;
+        }
+        return std::make_unique<StreamingAudioSource>(std::move(source));
+    }
+} // namespace OpenRCT2::Audio
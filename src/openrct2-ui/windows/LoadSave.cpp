@@ -17,18 +17,15 @@
 #include <openrct2-ui/windows/Windows.h>
 #include <openrct2/Diagnostic.h>
 #include <openrct2/Editor.h>
-#include <openrct2/FileClassifier.h>
 #include <openrct2/Game.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
-#include <openrct2/ParkImporter.h>
 #include <openrct2/PlatformEnvironment.h>
 #include <openrct2/SpriteIds.h>
 #include <openrct2/audio/Audio.h>
 #include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
-#include <openrct2/core/FileStream.h>
 #include <openrct2/core/Guard.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
@@ -41,8 +38,8 @@
 #include <openrct2/localisation/Formatter.h>
 #include <openrct2/localisation/Localisation.Date.h>
 #include <openrct2/network/Network.h>
-#include <openrct2/object/ObjectRepository.h>
 #include <openrct2/park/ParkPreview.h>
+#include <openrct2/park/ParkPreviewCache.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/rct2/T6Exporter.h>
 #include <openrct2/ride/TrackDesign.h>
@@ -138,6 +135,7 @@ namespace OpenRCT2::Ui::Windows
         LoadSaveType type;
         ParkPreview _preview;
         BackgroundWorker::Job _previewLoadJob;
+        std::vector<BackgroundWorker::Job> _previewPrefetchJobs;
 
         bool ShowPreviews()
         {
@@ -363,37 +361,54 @@ namespace OpenRCT2::Ui::Windows
                 _previewLoadJob.cancel();
             }
 
-            _previewLoadJob = bgWorker.addJob(
-                [path]() {
-                    try
-                    {
-                        auto fs = FileStream(path, FileMode::open);
+            auto& previewCache = GetContext()->GetParkPreviewCache();
+            if (auto preview = previewCache.TryGetRecent(path); preview != nullptr)
+            {
+                _preview = *preview;
+            }
+            else
+            {
+                _previewLoadJob = bgWorker.addJob(
+                    [path]() { return GetContext()->GetParkPreviewCache().Get(path); },
+                    [](std::shared_ptr<const ParkPreview> result) {
+                        auto* windowMgr = GetContext()->GetUiContext().GetWindowManager();
+                        auto* wnd = windowMgr->FindByClass(WindowClass::loadsave);
+                        if (wnd == nullptr)
+                        {
+                            return;
+                        }
+                        auto* loadSaveWnd = static_cast<LoadSaveWindow*>(wnd);
+                        loadSaveWnd->UpdateParkPreview(result != nullptr ? *result : ParkPreview{});
+                    });
+            }
 
-                        ClassifiedFileInfo info;
-                        if (!TryClassifyFile(&fs, &info) || info.Type != ::FileType::park)
-                            return ParkPreview{};
+            PrefetchPreviews();
+        }
 
-                        auto& objectRepository = GetContext()->GetObjectRepository();
-                        auto parkImporter = ParkImporter::CreateParkFile(objectRepository);
-                        parkImporter->LoadFromStream(&fs, false, true, path.c_str());
-                        return parkImporter->GetParkPreview();
-                    }
-                    catch (const std::exception& e)
-                    {
-                        LOG_ERROR("Could not get preview:", e.what());
-                        return ParkPreview{};
-                    }
-                },
-                [](const ParkPreview preview) {
-                    auto* windowMgr = GetContext()->GetUiContext().GetWindowManager();
-                    auto* wnd = windowMgr->FindByClass(WindowClass::loadsave);
-                    if (wnd == nullptr)
-                    {
-                        return;
-                    }
-                    auto* loadSaveWnd = static_cast<LoadSaveWindow*>(wnd);
-                    loadSaveWnd->UpdateParkPreview(preview);
-                });
+        // Reads the previews of the files around the selected one into the cache, so that they can be shown straight
+        // away when moving through the list.
+        void PrefetchPreviews()
+        {
+            for (auto& job : _previewPrefetchJobs)
+            {
+                job.cancel();
+            }
+            _previewPrefetchJobs.clear();
+
+            auto& bgWorker = GetContext()->GetBackgroundWorker();
+            for (auto offset : { 1, -1, 2, -2 })
+            {
+                const auto index = selectedListItem + offset;
+                if (index < 0 || index >= static_cast<int32_t>(_listItems.size()))
+                    continue;
+
+                const auto& item = _listItems[index];
+                if (item.type == FileType::directory)
+                    continue;
+
+                _previewPrefetchJobs.push_back(
+                    bgWorker.addJob([path = item.path]() { GetContext()->GetParkPreviewCache().Get(path); }, []() {}));
+            }
         }
 
         void UpdateParkPreview(const ParkPreview& preview)
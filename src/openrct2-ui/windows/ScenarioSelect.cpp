@@ -19,7 +19,7 @@
 #include <openrct2/SpriteIds.h>
 #include <openrct2/audio/Audio.h>
 #include <openrct2/config/Config.h>
-#include <openrct2/core/FileStream.h>
+#include <openrct2/core/Path.hpp>
 #include <openrct2/drawing/ColourMap.h>
 #include <openrct2/drawing/Drawing.String.h>
 #include <openrct2/drawing/Drawing.h>
@@ -32,6 +32,7 @@
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/object/ScenarioMetaObject.h>
 #include <openrct2/park/ParkPreview.h>
+#include <openrct2/park/ParkPreviewCache.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/scenario/ScenarioCategory.h>
@@ -133,6 +134,7 @@ namespace OpenRCT2::Ui::Windows
         const ScenarioIndexEntry* _highlightedScenario = nullptr;
         ParkPreview _preview;
         BackgroundWorker::Job _previewLoadJob;
+        std::vector<BackgroundWorker::Job> _previewPrefetchJobs;
 
     public:
         ScenarioSelectWindow(std::function<void(std::string_view)> callback)
@@ -217,32 +219,27 @@ namespace OpenRCT2::Ui::Windows
 
             if (isClassified && info.Type == FileType::park)
             {
-                _previewLoadJob = bgWorker.addJob(
-                    [path, name]() {
-                        try
-                        {
-                            auto fs = FileStream(path, FileMode::open);
-                            auto& objectRepository = GetContext()->GetObjectRepository();
-                            auto parkImporter = ParkImporter::CreateParkFile(objectRepository);
-                            parkImporter->LoadFromStream(&fs, false, true, path.c_str());
-                            return parkImporter->GetParkPreview();
-                        }
-                        catch (const std::exception& e)
-                        {
-                            LOG_ERROR("Could not get preview for \"%s\" due to %s", path.c_str(), e.what());
-                            return ParkPreview{};
-                        }
-                    },
-                    [](const ParkPreview preview) {
-                        auto* windowMgr = GetWindowManager();
-                        auto* wnd = windowMgr->FindByClass(WindowClass::scenarioSelect);
-                        if (wnd == nullptr)
-                        {
-                            return;
-                        }
-                        auto* scenarioSelectWnd = static_cast<ScenarioSelectWindow*>(wnd);
-                        scenarioSelectWnd->UpdateParkPreview(preview);
-                    });
+                auto& previewCache = GetContext()->GetParkPreviewCache();
+                if (auto preview = previewCache.TryGetRecent(path); preview != nullptr)
+                {
+                    _preview = *preview;
+                }
+                else
+                {
+                    _previewLoadJob = bgWorker.addJob(
+                        [path]() { return GetContext()->GetParkPreviewCache().Get(path); },
+                        [](std::shared_ptr<const ParkPreview> result) {
+                            auto* windowMgr = GetWindowManager();
+                            auto* wnd = windowMgr->FindByClass(WindowClass::scenarioSelect);
+                            if (wnd == nullptr)
+                            {
+                                return;
+                            }
+                            auto* scenarioSelectWnd = static_cast<ScenarioSelectWindow*>(wnd);
+                            scenarioSelectWnd->UpdateParkPreview(result != nullptr ? *result : ParkPreview{});
+                        });
+                }
+                PrefetchPreviews();
             }
             else
             {
@@ -266,6 +263,43 @@ namespace OpenRCT2::Ui::Windows
             }
         }
 
+        // Reads the previews of the park scenarios around the highlighted one into the cache, so that they can be shown
+        // straight away when moving through the list.
+        void PrefetchPreviews()
+        {
+            for (auto& job : _previewPrefetchJobs)
+            {
+                job.cancel();
+            }
+            _previewPrefetchJobs.clear();
+
+            auto it = std::find_if(_listItems.begin(), _listItems.end(), [this](const ScenarioListItem& listItem) {
+                return listItem.type == ListItemType::Scenario && listItem.scenario.scenario == _highlightedScenario;
+            });
+            if (it == _listItems.end())
+                return;
+
+            auto& bgWorker = GetContext()->GetBackgroundWorker();
+            const auto highlightedIndex = std::distance(_listItems.begin(), it);
+            for (auto offset : { 1, -1, 2, -2 })
+            {
+                const auto index = highlightedIndex + offset;
+                if (index < 0 || index >= static_cast<ptrdiff_t>(_listItems.size()))
+                    continue;
+
+                const auto& listItem = _listItems[index];
+                if (listItem.type != ListItemType::Scenario)
+                    continue;
+
+                const auto& path = listItem.scenario.scenario->Path;
+                if (!ParkImporter::ExtensionIsOpenRCT2ParkFile(Path::GetExtension(path)))
+                    continue;
+
+                _previewPrefetchJobs.push_back(
+                    bgWorker.addJob([path]() { GetContext()->GetParkPreviewCache().Get(path); }, []() {}));
+            }
+        }
+
         void UpdateParkPreview(const ParkPreview& preview)
         {
             _preview = preview;
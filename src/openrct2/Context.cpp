@@ -59,6 +59,7 @@
 #include "object/ObjectRepository.h"
 #include "paint/Painter.h"
 #include "park/ParkFile.h"
+#include "park/ParkPreviewCache.h"
 #include "platform/Crash.h"
 #include "platform/Platform.h"
 #include "profiling/Profiling.h"
@@ -159,6 +160,8 @@ namespace OpenRCT2
         std::thread::id _mainThreadId{};
         Timer _forcedUpdateTimer;
 
+        // Declared before the background worker, whose jobs use it and are stopped first.
+        ParkPreviewCache _parkPreviewCache;
         BackgroundWorker _backgroundWorker;
 
     public:
@@ -184,12 +187,14 @@ namespace OpenRCT2
             , _network(*this)
 #endif
             , _painter(std::make_unique<Paint::Painter>(*_uiContext))
+            , _parkPreviewCache(Path::Combine(_env->GetDirectoryPath(DirBase::cache), u8"park_previews"))
         {
             // Can't have more than one context currently.
             Guard::Assert(Instance == nullptr);
 
             Instance = this;
             _mainThreadId = std::this_thread::get_id();
+            Profiling::setThreadName("Main");
         }
 
         ~Context() override
@@ -1298,6 +1303,7 @@ namespace OpenRCT2
         void RunFrame()
         {
             PROFILED_FUNCTION();
+            Profiling::addMarker(Profiling::Marker::frame);
 
             const auto deltaTime = _timer.GetElapsedTimeAndRestart().count();
 
@@ -1418,6 +1424,9 @@ namespace OpenRCT2
         {
             PROFILED_FUNCTION();
 
+            // Drop decoded object images over budget before any of the painting threads can look them up.
+            GfxTrimDeferredImages();
+
             _drawingEngine->BeginDraw();
             _painter->Paint(*_drawingEngine);
             _drawingEngine->EndDraw();
@@ -1426,6 +1435,7 @@ namespace OpenRCT2
         void Tick()
         {
             PROFILED_FUNCTION();
+            Profiling::addMarker(Profiling::Marker::tick);
 
             // TODO: This variable has been never "variable" in time, some code expects
             // this to be 40Hz (25 ms). Refactor this once the UI is decoupled.
@@ -1591,6 +1601,11 @@ namespace OpenRCT2
         {
             return _backgroundWorker;
         }
+
+        ParkPreviewCache& GetParkPreviewCache() override
+        {
+            return _parkPreviewCache;
+        }
     };
 
     Context* Context::Instance = nullptr;
@@ -33,6 +33,7 @@ namespace OpenRCT2
     class AssetPackManager;
     class Formatter;
     class Intent;
+    class ParkPreviewCache;
     struct CursorState;
     struct IObjectManager;
     struct IObjectRepository;
@@ -144,6 +145,7 @@ namespace OpenRCT2
         virtual float GetTimeScale() const = 0;
 
         virtual BackgroundWorker& GetBackgroundWorker() = 0;
+        virtual ParkPreviewCache& GetParkPreviewCache() = 0;
     };
 
     [[nodiscard]] std::unique_ptr<IContext> CreateContext();
@@ -310,14 +310,23 @@ namespace OpenRCT2
         Weather::update();
         MapUpdateTiles();
 
+        // Provisional elements are only ever placed by the user interface.
+        const bool hasPresentation = isPresentationEnabled();
+
         // Temporarily remove provisional paths to prevent peep from interacting with them
-        auto removeProvisionalIntent = Intent(INTENT_ACTION_REMOVE_PROVISIONAL_ELEMENTS);
-        ContextBroadcastIntent(&removeProvisionalIntent);
+        if (hasPresentation)
+        {
+            auto removeProvisionalIntent = Intent(INTENT_ACTION_REMOVE_PROVISIONAL_ELEMENTS);
+            ContextBroadcastIntent(&removeProvisionalIntent);
+        }
 
         MapUpdatePathWideFlags();
         PeepUpdateAll();
-        auto restoreProvisionalIntent = Intent(INTENT_ACTION_RESTORE_PROVISIONAL_ELEMENTS);
-        ContextBroadcastIntent(&restoreProvisionalIntent);
+        if (hasPresentation)
+        {
+            auto restoreProvisionalIntent = Intent(INTENT_ACTION_RESTORE_PROVISIONAL_ELEMENTS);
+            ContextBroadcastIntent(&restoreProvisionalIntent);
+        }
         VehicleUpdateAll();
         gameState.entities.UpdateAllMiscEntities();
         Ride::updateAll();
@@ -334,10 +343,13 @@ namespace OpenRCT2
         News::UpdateCurrentItem();
 
         MapAnimations::InvalidateAndUpdateAll();
-        VehicleSoundsUpdate();
-        PeepUpdateCrowdNoise();
-        Weather::updateSound();
-        EditorOpenWindowsForCurrentStep();
+        if (hasPresentation)
+        {
+            VehicleSoundsUpdate();
+            PeepUpdateCrowdNoise();
+            Weather::updateSound();
+            EditorOpenWindowsForCurrentStep();
+        }
 
         // Update windows
         // WindowDispatchUpdateAll();
@@ -69,7 +69,8 @@ namespace OpenRCT2
         std::array<Ride, Limits::kMaxRidesInPark> rides{};
         size_t ridesEndOfUsedRange{};
         RideRating::UpdateStates rideRatingUpdateStates;
-        std::vector<TileElement> tileElements;
+        // Tile elements grouped by map region, see TilePointerIndex::kRegionSize
+        std::vector<std::vector<TileElement>> tileElementRegions;
 
         std::vector<ScenerySelection> restrictedScenery;
 
@@ -45,6 +45,7 @@ extern u8string gCustomRCT2DataPath;
 extern u8string gCustomPassword;
 extern bool gOpenRCT2Headless;
 extern bool gOpenRCT2NoGraphics;
+extern bool gOpenRCT2NoPresentation;
 extern bool gOpenRCT2ShowChangelog;
 extern bool gOpenRCT2SilentBreakpad;
 extern u8string gSilentRecordingName;
@@ -70,6 +71,16 @@ namespace OpenRCT2
     int32_t CommandLineRun(const char** argv, int32_t argc);
 } // namespace OpenRCT2
 
+/**
+ * Returns false when nothing is ever going to be drawn or heard, e.g. for the simulate command or a dedicated
+ * server. Work that only feeds the screen or audio (viewport and window invalidation, sprite bounds, sounds) is
+ * skipped in that case; the game state must stay identical either way.
+ */
+inline bool isPresentationEnabled()
+{
+    return !gOpenRCT2NoPresentation;
+}
+
 extern uint32_t gCurrentDrawCount;
 extern LegacyScene gLegacyScene;
 extern uint32_t gScreenAge;
@@ -55,6 +55,17 @@ public:
         OpenRCT2::IStream* stream, bool isScenario, bool skipObjectCheck = false, const u8string& path = {})
         = 0;
 
+    /**
+     * Only reads what PopulateIndexEntry needs from a scenario, which is much cheaper than a full load when building the
+     * scenario index. Import can not be used afterwards.
+     */
+    virtual void LoadScenarioMetadata(OpenRCT2::IStream* stream, const u8string& path = {}) = 0;
+
+    /**
+     * Only reads what GetParkPreview needs, for showing previews in the file browsers. Import can not be used afterwards.
+     */
+    virtual void LoadParkPreview(OpenRCT2::IStream* stream) = 0;
+
     virtual void Import(OpenRCT2::GameState_t& gameState) = 0;
     virtual bool PopulateIndexEntry(ScenarioIndexEntry* dst) = 0;
     virtual OpenRCT2::ParkPreview GetParkPreview() = 0;
@@ -44,9 +44,12 @@
 #include "scenario/Scenario.h"
 #include "world/Park.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
+#include <future>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -84,6 +87,13 @@ namespace OpenRCT2
         }
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        MemoryStream parkData;
+        MemoryStream parkParams;
+    };
+
     struct ReplayRecordFile
     {
         uint32_t magic;
@@ -106,19 +116,25 @@ namespace OpenRCT2
         uint32_t tickStart;    // First tick of replay.
         uint32_t tickEnd;      // Last tick of replay.
         std::multiset<ReplayCommand> commands;
+        std::multiset<ReplayCommand>::const_iterator nextCommand; // Next command to run during playback.
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes; // Saved park states to seek to, ordered by tick.
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t kReplayVersion = 11;
+        static constexpr uint16_t kReplayVersion = 13;
+        static constexpr uint16_t kReplayKeyframesVersion = 12;
+        static constexpr uint16_t kReplayTouchedChecksumVersion = 13;
         static constexpr uint16_t kReplayMinCompatVersion = 10;
         static constexpr uint32_t kReplayMagic = 0x5243524F; // ORCR.
         static constexpr int kReplayCompressionLevel = 18;
         static constexpr int kNormalRecordingChecksumTicks = 1;
         static constexpr int kSilentRecordingChecksumTicks = 40; // Same as network server
+        // About 100 seconds of game time, seeking never has to simulate more than this.
+        static constexpr uint32_t kDefaultKeyframeTicks = 4000;
 
         enum class ReplayMode
         {
@@ -138,6 +154,7 @@ namespace OpenRCT2
     public:
         virtual ~ReplayManager()
         {
+            WaitForPendingWrite();
         }
 
         virtual bool IsReplaying() const override
@@ -183,9 +200,17 @@ namespace OpenRCT2
 
             const auto currentTicks = getGameState().currentTicks;
 
+            // Silent recordings are mostly discarded, so they do not pay for the keyframes.
+            if (((_mode == ReplayMode::RECORDING && _recordType == RecordType::NORMAL) || _mode == ReplayMode::NORMALISATION)
+                && currentTicks == _nextKeyframeTick)
+            {
+                AddKeyframe(currentTicks);
+                _nextKeyframeTick = currentTicks + _keyframeTicks;
+            }
+
             if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && currentTicks == _nextChecksumTick)
             {
-                EntitiesChecksum checksum = getGameState().entities.GetAllEntitiesChecksum();
+                EntitiesChecksum checksum = getGameState().entities.GetTouchedEntitiesChecksum();
                 AddChecksum(currentTicks, std::move(checksum));
 
                 _nextChecksumTick = currentTicks + ChecksumTicksDelta();
@@ -200,6 +225,12 @@ namespace OpenRCT2
             }
             else if (_mode == ReplayMode::PLAYING)
             {
+                // The recording hashed all entities again at each keyframe, so changes that did not mark an entity are
+                // picked up at the same ticks whether playback ran straight through or seeked to the keyframe.
+                if (IsKeyframeTick(*_currentReplay, currentTicks))
+                {
+                    getGameState().entities.MarkAllEntitiesTouched();
+                }
 #ifndef DISABLE_NETWORK
                 // If the network is disabled we will only get a dummy hash which will cause
                 // false positives during replay.
@@ -221,7 +252,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -232,6 +263,24 @@ namespace OpenRCT2
             }
         }
 
+        void AddKeyframe(uint32_t tick)
+        {
+            auto& keyframe = _currentRecording->keyframes.emplace_back();
+            keyframe.tick = tick;
+
+            // Captured before the commands of this tick run, which is where playback resumes after seeking to it.
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->ExportObjectsList = GetContext()->GetObjectManager().GetPackableObjects();
+            exporter->Export(getGameState(), keyframe.parkData, Compression::kNoCompressionLevel);
+
+            DataSerialiser parkParamsDs(true, keyframe.parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            // Seeking to the keyframe hashes all entities again, so the recording does the same before the checksum of this
+            // tick.
+            getGameState().entities.MarkAllEntitiesTouched();
+        }
+
         void TakeGameStateSnapshot(MemoryStream& snapshotStream)
         {
             IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
@@ -288,16 +337,25 @@ namespace OpenRCT2
 
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
+            // Playback starts with all entities hashed from the loaded park.
+            gameState.entities.MarkAllEntitiesTouched();
+
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::RECORDING;
 
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = currentTicks + 1;
+            _nextKeyframeTick = currentTicks + _keyframeTicks;
 
             return true;
         }
 
+        void SetKeyframeInterval(uint32_t ticks) override
+        {
+            _keyframeTicks = std::max<uint32_t>(ticks, 1);
+        }
+
         virtual bool StopRecording(bool discard = false) override
         {
             if (_mode != ReplayMode::RECORDING && _mode != ReplayMode::NORMALISATION)
@@ -315,42 +373,31 @@ namespace OpenRCT2
             _currentRecording->tickEnd = currentTicks;
 
             {
-                EntitiesChecksum checksum = getGameState().entities.GetAllEntitiesChecksum();
+                EntitiesChecksum checksum = getGameState().entities.GetTouchedEntitiesChecksum();
                 AddChecksum(currentTicks, std::move(checksum));
             }
 
             TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
 
-            // Serialise Body.
-            DataSerialiser recSerialiser(true);
-            Serialise(recSerialiser, *_currentRecording);
-            auto& stream = recSerialiser.GetStream();
-
-            MemoryStream compressed;
-            stream.SetPosition(0);
-            // header already has decompressed length, but no checksum, so use the ZStandard checksum
-            bool compressStatus = Compression::zstdCompress(
-                stream, stream.GetLength(), compressed, Compression::ZstdMetadata::checksum, kReplayCompressionLevel);
-            if (!compressStatus)
-                throw IOException("Compression Error");
-
-            {
-                ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, stream.GetLength(), compressed };
-
-                FileStream filestream(_currentRecording->filePath, FileMode::write);
-                DataSerialiser fileSerialiser(true, filestream);
-                fileSerialiser << file.magic;
-                fileSerialiser << file.version;
-                fileSerialiser << file.uncompressedSize;
-                fileSerialiser << file.data;
-            }
+            // Compressing a long recording takes seconds, so it is written out on a thread of its own. Only one recording
+            // is written at a time, silent recordings keep overwriting the same file.
+            WaitForPendingWrite();
+            _pendingWrite = std::async(
+                std::launch::async, [this, recording = std::shared_ptr<ReplayRecordData>(std::move(_currentRecording))] {
+                    try
+                    {
+                        WriteReplayData(*recording);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_ERROR("Unable to write replay '%s': %s", recording->filePath.c_str(), e.what());
+                    }
+                });
 
             // When normalizing the output we don't touch the mode.
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::NONE;
 
-            _currentRecording.reset();
-
             News::Item* news = News::AddItemToQueue(News::ItemType::blank, "Replay recording stopped", 0);
             news->setFlags(News::ItemFlags::hasButton); // Has no subject.
 
@@ -433,6 +480,9 @@ namespace OpenRCT2
 
             auto replayData = std::make_unique<ReplayRecordData>();
 
+            // The replay may be the one that was just recorded.
+            WaitForPendingWrite();
+
             try
             {
                 ReadReplayData(file, *replayData);
@@ -442,7 +492,7 @@ namespace OpenRCT2
                 throw;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            if (!LoadReplayDataMap(replayData->parkData, replayData->parkParams))
             {
                 throw std::runtime_error("Unable to load map.");
             }
@@ -452,8 +502,10 @@ namespace OpenRCT2
             LoadAndCompareSnapshot(replayData->gameStateSnapshots);
 
             _currentReplay = std::move(replayData);
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
+            _faultyChecksumTick.reset();
 
             // Make sure game is not paused.
             gGamePaused = 0;
@@ -467,6 +519,54 @@ namespace OpenRCT2
             return _faultyChecksumIndex != -1;
         }
 
+        std::optional<uint32_t> GetPlaybackMismatchTick() const override
+        {
+            return _faultyChecksumTick;
+        }
+
+        uint32_t SeekPlayback(uint32_t tick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                throw std::invalid_argument(std::string("Unexpected mode ") + modeToName[EnumValue(_mode)]);
+
+            auto& replay = *_currentReplay;
+            tick = std::clamp(tick, replay.tickStart, replay.tickEnd);
+
+            // Use the last keyframe before the tick, or the start of the replay if there is none.
+            auto keyframe = std::upper_bound(
+                replay.keyframes.begin(), replay.keyframes.end(), tick,
+                [](uint32_t value, const ReplayKeyframe& item) { return value < item.tick; });
+            ReplayKeyframe* target = keyframe != replay.keyframes.begin() ? &*std::prev(keyframe) : nullptr;
+            const uint32_t targetTick = target != nullptr ? target->tick : replay.tickStart;
+
+            // Carry on from the current state if it is already closer than the keyframe and still good.
+            auto& gameState = getGameState();
+            if (gameState.currentTicks <= tick && gameState.currentTicks >= targetTick && !IsPlaybackStateMismatching())
+                return gameState.currentTicks;
+
+            auto& parkData = target != nullptr ? target->parkData : replay.parkData;
+            auto& parkParams = target != nullptr ? target->parkParams : replay.parkParams;
+            parkParams.SetPosition(0);
+            if (!LoadReplayDataMap(parkData, parkParams))
+            {
+                throw std::runtime_error("Unable to load map.");
+            }
+            gameState.currentTicks = targetTick;
+
+            ReplayCommand firstCommand;
+            firstCommand.tick = targetTick;
+            replay.nextCommand = replay.commands.lower_bound(firstCommand);
+
+            auto checksum = std::lower_bound(
+                replay.checksums.begin(), replay.checksums.end(), targetTick,
+                [](const auto& item, uint32_t value) { return item.first < value; });
+            replay.checksumIndex = static_cast<uint32_t>(std::distance(replay.checksums.begin(), checksum));
+            _faultyChecksumIndex = -1;
+            _faultyChecksumTick.reset();
+
+            return targetTick;
+        }
+
         virtual bool StopPlayback() override
         {
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
@@ -529,17 +629,58 @@ namespace OpenRCT2
             }
         }
 
-        bool LoadReplayDataMap(ReplayRecordData& data)
+        static bool IsKeyframeTick(const ReplayRecordData& replay, uint32_t tick)
+        {
+            auto keyframe = std::lower_bound(
+                replay.keyframes.begin(), replay.keyframes.end(), tick,
+                [](const ReplayKeyframe& item, uint32_t value) { return item.tick < value; });
+            return keyframe != replay.keyframes.end() && keyframe->tick == tick;
+        }
+
+        void WaitForPendingWrite()
+        {
+            if (_pendingWrite.valid())
+            {
+                _pendingWrite.get();
+            }
+        }
+
+        void WriteReplayData(ReplayRecordData& data)
+        {
+            // Serialise Body.
+            DataSerialiser recSerialiser(true);
+            Serialise(recSerialiser, data);
+            auto& stream = recSerialiser.GetStream();
+
+            MemoryStream compressed;
+            stream.SetPosition(0);
+            // header already has decompressed length, but no checksum, so use the ZStandard checksum
+            bool compressStatus = Compression::zstdCompress(
+                stream, stream.GetLength(), compressed, Compression::ZstdMetadata::checksum, kReplayCompressionLevel);
+            if (!compressStatus)
+                throw IOException("Compression Error");
+
+            ReplayRecordFile file{ data.magic, data.version, stream.GetLength(), compressed };
+
+            FileStream filestream(data.filePath, FileMode::write);
+            DataSerialiser fileSerialiser(true, filestream);
+            fileSerialiser << file.magic;
+            fileSerialiser << file.version;
+            fileSerialiser << file.uncompressedSize;
+            fileSerialiser << file.data;
+        }
+
+        bool LoadReplayDataMap(MemoryStream& parkData, MemoryStream& parkParams)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 // TODO: Have a separate GameState and exchange once loaded.
@@ -549,11 +690,12 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 GameLoadInit();
                 FixInvalidVehicleSpriteSizes();
+                gameState.entities.MarkAllEntitiesTouched();
             }
             catch (const std::exception& ex)
             {
@@ -651,6 +793,11 @@ namespace OpenRCT2
             data.parkParams.SetPosition(0);
             data.cheatData.SetPosition(0);
             data.gameStateSnapshots.SetPosition(0);
+            for (auto& keyframe : data.keyframes)
+            {
+                keyframe.parkData.SetPosition(0);
+                keyframe.parkParams.SetPosition(0);
+            }
         }
 
         bool SerialiseCheats(DataSerialiser& serialiser)
@@ -788,6 +935,24 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= kReplayKeyframesVersion)
+            {
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.parkData;
+                    serialiser << keyframe.parkParams;
+                }
+            }
             return true;
         }
 
@@ -806,7 +971,11 @@ namespace OpenRCT2
             {
                 _currentReplay->checksumIndex++;
 
-                EntitiesChecksum checksum = getGameState().entities.GetAllEntitiesChecksum();
+                // Older replays were recorded with checksums of all entities.
+                auto& entities = getGameState().entities;
+                EntitiesChecksum checksum = _currentReplay->version >= kReplayTouchedChecksumVersion
+                    ? entities.GetTouchedEntitiesChecksum()
+                    : entities.GetAllEntitiesChecksum();
                 if (savedChecksum.second.raw != checksum.raw)
                 {
                     uint32_t replayTick = currentTicks - _currentReplay->tickStart;
@@ -817,6 +986,8 @@ namespace OpenRCT2
                         replayTick, savedChecksum.second.ToString().c_str(), checksum.ToString().c_str());
 
                     _faultyChecksumIndex = checksumIndex;
+                    if (!_faultyChecksumTick.has_value())
+                        _faultyChecksumTick = currentTicks;
                 }
                 else
                 {
@@ -831,14 +1002,16 @@ namespace OpenRCT2
 
         void ReplayCommands()
         {
+            // Commands are kept after running them so that playback can seek back to an earlier keyframe.
             auto& replayQueue = _currentReplay->commands;
+            auto& nextCommand = _currentReplay->nextCommand;
 
             auto& gameState = getGameState();
             const auto currentTicks = gameState.currentTicks;
 
-            while (replayQueue.begin() != replayQueue.end())
+            while (nextCommand != replayQueue.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -874,7 +1047,7 @@ namespace OpenRCT2
                         WindowScrollToLocation(*mainWindow, result.position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                ++nextCommand;
             }
         }
 
@@ -883,8 +1056,12 @@ namespace OpenRCT2
         std::unique_ptr<ReplayRecordData> _currentRecording;
         std::unique_ptr<ReplayRecordData> _currentReplay;
         int32_t _faultyChecksumIndex = -1;
+        std::optional<uint32_t> _faultyChecksumTick;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
+        uint32_t _keyframeTicks = kDefaultKeyframeTicks;
+        std::future<void> _pendingWrite;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
@@ -11,6 +11,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -57,11 +58,17 @@ namespace OpenRCT2
         virtual bool StartRecording(
             const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL)
             = 0;
+        // Sets the number of ticks between the keyframes of the recordings started after this.
+        virtual void SetKeyframeInterval(uint32_t ticks) = 0;
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo& info) const = 0;
 
         virtual void StartPlayback(const std::string& file) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
+        // The first tick whose state did not match the recording, kept after playback stops.
+        virtual std::optional<uint32_t> GetPlaybackMismatchTick() const = 0;
+        // Restores the last keyframe at or before the tick and returns the tick playback continues from.
+        virtual uint32_t SeekPlayback(uint32_t tick) = 0;
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
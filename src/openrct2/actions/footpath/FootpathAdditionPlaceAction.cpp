@@ -183,6 +183,7 @@ namespace OpenRCT2::GameActions
 
         pathElement->SetAdditionEntryIndex(_entryIndex);
         pathElement->SetIsBroken(false);
+        FootpathBinIndexMarkTile(_loc);
         if (pathAdditionEntry->flags & PATH_ADDITION_FLAG_IS_BIN)
         {
             pathElement->SetAdditionStatus(255);
@@ -0,0 +1,138 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioMixing.h"
+
+#include <algorithm>
+#include <cstring>
+
+// SSE2 is part of the x86-64 baseline, so the mixing kernel does not need runtime dispatch.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define AUDIO_MIXING_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace OpenRCT2::Audio
+{
+    static void MixFramesScalar(
+        int16_t* dst, int32_t startFrame, int32_t endFrame, const int16_t* src, int32_t srcFrames, double ratio,
+        const MixGains& gains)
+    {
+        for (int32_t i = startFrame; i < endFrame; i++)
+        {
+            double srcPos = i * ratio;
+            int32_t index = static_cast<int32_t>(srcPos);
+            auto frac = static_cast<float>(srcPos - index);
+
+            // Clamp to avoid reading past end
+            if (index >= srcFrames - 1)
+            {
+                index = srcFrames - 2;
+                frac = 1.0f;
+            }
+
+            const float pan[2] = { gains.panLeft + i * gains.panLeftStep, gains.panRight + i * gains.panRightStep };
+            for (int32_t ch = 0; ch < 2; ch++)
+            {
+                const float s1 = src[index * 2 + ch];
+                const float s2 = src[index * 2 + 2 + ch];
+                const float volume = gains.volume + (i * 2 + ch) * gains.volumeStep;
+                const auto sample = std::clamp(
+                    static_cast<int32_t>((s1 + (s2 - s1) * frac) * pan[ch] * volume), -32768, 32767);
+                dst[i * 2 + ch] = static_cast<int16_t>(std::clamp(dst[i * 2 + ch] + sample, -32768, 32767));
+            }
+        }
+    }
+
+#ifdef AUDIO_MIXING_SSE2
+
+    // Loads the stereo frames at the given indices, each frame being one 32-bit lane of two 16-bit samples.
+    static __m128i LoadFrames(const int16_t* src, const int32_t (&index)[4], int32_t offset)
+    {
+        int32_t frames[4];
+        for (int32_t k = 0; k < 4; k++)
+        {
+            std::memcpy(&frames[k], src + (index[k] + offset) * 2, sizeof(int32_t));
+        }
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(frames));
+    }
+
+#endif
+
+    void MixResampledS16Stereo(
+        int16_t* dst, int32_t dstFrames, const int16_t* src, int32_t srcFrames, double ratio, const MixGains& gains)
+    {
+        if (dstFrames <= 0 || srcFrames < 2)
+            return;
+
+        int32_t i = 0;
+#ifdef AUDIO_MIXING_SSE2
+        // Four frames (eight samples) per iteration while all interpolation pairs are inside the source.
+        const __m128 panBase = _mm_setr_ps(gains.panLeft, gains.panRight, gains.panLeft, gains.panRight);
+        const __m128 panStep = _mm_setr_ps(gains.panLeftStep, gains.panRightStep, gains.panLeftStep, gains.panRightStep);
+        const __m128 volumeBase = _mm_set1_ps(gains.volume);
+        const __m128 volumeStep = _mm_set1_ps(gains.volumeStep);
+        const __m128 sampleOffsets = _mm_setr_ps(0, 1, 2, 3);
+        for (; i + 4 <= dstFrames; i += 4)
+        {
+            int32_t index[4];
+            float frac[4];
+            for (int32_t k = 0; k < 4; k++)
+            {
+                const double srcPos = (i + k) * ratio;
+                index[k] = static_cast<int32_t>(srcPos);
+                frac[k] = static_cast<float>(srcPos - index[k]);
+            }
+            if (index[3] >= srcFrames - 1)
+                break;
+
+            // Widen the 16-bit samples of the interpolation pairs to 32-bit floats.
+            const __m128i first = LoadFrames(src, index, 0);
+            const __m128i second = LoadFrames(src, index, 1);
+            const __m128 s1Lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(first, first), 16));
+            const __m128 s1Hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(first, first), 16));
+            const __m128 s2Lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(second, second), 16));
+            const __m128 s2Hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(second, second), 16));
+
+            const __m128 fracLo = _mm_setr_ps(frac[0], frac[0], frac[1], frac[1]);
+            const __m128 fracHi = _mm_setr_ps(frac[2], frac[2], frac[3], frac[3]);
+            const __m128 sampleLo = _mm_add_ps(s1Lo, _mm_mul_ps(_mm_sub_ps(s2Lo, s1Lo), fracLo));
+            const __m128 sampleHi = _mm_add_ps(s1Hi, _mm_mul_ps(_mm_sub_ps(s2Hi, s1Hi), fracHi));
+
+            const auto frame = static_cast<float>(i);
+            const __m128 frameLo = _mm_setr_ps(frame, frame, frame + 1, frame + 1);
+            const __m128 frameHi = _mm_add_ps(frameLo, _mm_set1_ps(2));
+            const __m128 panLo = _mm_add_ps(panBase, _mm_mul_ps(frameLo, panStep));
+            const __m128 panHi = _mm_add_ps(panBase, _mm_mul_ps(frameHi, panStep));
+
+            const __m128 sampleIndexLo = _mm_add_ps(_mm_set1_ps(frame * 2), sampleOffsets);
+            const __m128 sampleIndexHi = _mm_add_ps(sampleIndexLo, _mm_set1_ps(4));
+            const __m128 volumeLo = _mm_add_ps(volumeBase, _mm_mul_ps(sampleIndexLo, volumeStep));
+            const __m128 volumeHi = _mm_add_ps(volumeBase, _mm_mul_ps(sampleIndexHi, volumeStep));
+
+            const __m128i mixedLo = _mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(sampleLo, panLo), volumeLo));
+            const __m128i mixedHi = _mm_cvttps_epi32(_mm_mul_ps(_mm_mul_ps(sampleHi, panHi), volumeHi));
+            const __m128i mixed = _mm_packs_epi32(mixedLo, mixedHi);
+
+            auto* out = reinterpret_cast<__m128i*>(dst + i * 2);
+            _mm_storeu_si128(out, _mm_adds_epi16(_mm_loadu_si128(out), mixed));
+        }
+#endif
+        MixFramesScalar(dst, i, dstFrames, src, srcFrames, ratio, gains);
+    }
+
+    void MixResampledS16StereoScalar(
+        int16_t* dst, int32_t dstFrames, const int16_t* src, int32_t srcFrames, double ratio, const MixGains& gains)
+    {
+        if (dstFrames <= 0 || srcFrames < 2)
+            return;
+
+        MixFramesScalar(dst, 0, dstFrames, src, srcFrames, ratio, gains);
+    }
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * Per channel gains for MixResampledS16Stereo, ramped linearly across the mixed chunk.
+     */
+    struct MixGains
+    {
+        // Pan gains at the first frame and their change per frame.
+        float panLeft;
+        float panRight;
+        float panLeftStep;
+        float panRightStep;
+
+        // Volume at the first sample and its change per (interleaved) sample.
+        float volume;
+        float volumeStep;
+    };
+
+    /**
+     * Resamples src with linear interpolation, applies the pan and volume ramps and mixes the result on to dst
+     * with saturation, in a single pass. Both buffers are interleaved signed 16-bit stereo.
+     */
+    void MixResampledS16Stereo(
+        int16_t* dst, int32_t dstFrames, const int16_t* src, int32_t srcFrames, double ratio, const MixGains& gains);
+    void MixResampledS16StereoScalar(
+        int16_t* dst, int32_t dstFrames, const int16_t* src, int32_t srcFrames, double ratio, const MixGains& gains);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,149 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/Timer.hpp"
+#include "../drawing/Drawing.h"
+#include "../drawing/X8DrawingEngine.h"
+#include "../interface/Viewport.h"
+#include "../world/Map.h"
+#include "CommandLine.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace OpenRCT2::Drawing;
+
+namespace OpenRCT2
+{
+    static constexpr int32_t kBenchPaintDefaultIterations = 50;
+    static constexpr int32_t kBenchPaintWidth = 1920;
+    static constexpr int32_t kBenchPaintHeight = 1080;
+    static constexpr int8_t kBenchPaintMaxZoom = 2;
+
+    static exitcode_t HandleBenchPaint(CommandLineArgEnumerator* argEnumerator);
+
+    // clang-format off
+    const CommandLineCommand CommandLine::kBenchPaintCommands[]{
+        // Main commands
+        DefineCommand("", "<park file> [iterations]", nullptr, HandleBenchPaint),
+        kCommandTableEnd
+    };
+    // clang-format on
+
+    static Viewport GetBenchPaintViewport(uint8_t rotation, ZoomLevel zoom)
+    {
+        const auto& mapSize = getGameState().mapSize;
+        const CoordsXY centre = { (mapSize.x / 2) * kCoordsXYStep + 16, (mapSize.y / 2) * kCoordsXYStep + 16 };
+        const auto centre2d = Translate3DTo2DWithZ(rotation, { centre, TileElementHeight(centre) });
+
+        Viewport viewport{};
+        viewport.width = kBenchPaintWidth;
+        viewport.height = kBenchPaintHeight;
+        viewport.zoom = zoom;
+        viewport.rotation = rotation;
+        viewport.viewPos = { centre2d.x - zoom.ApplyTo(kBenchPaintWidth / 2),
+                             centre2d.y - zoom.ApplyTo(kBenchPaintHeight / 2) };
+        return viewport;
+    }
+
+    static exitcode_t HandleBenchPaint(CommandLineArgEnumerator* argEnumerator)
+    {
+        const utf8* inputPath;
+        if (!argEnumerator->TryPopString(&inputPath))
+        {
+            Console::Error::WriteLine("Expected a save file path");
+            return EXITCODE_FAIL;
+        }
+
+        int32_t iterations;
+        if (!argEnumerator->TryPopInteger(&iterations))
+        {
+            iterations = kBenchPaintDefaultIterations;
+        }
+        if (iterations <= 0)
+        {
+            Console::Error::WriteLine("Expected a positive number of iterations");
+            return EXITCODE_FAIL;
+        }
+
+        gOpenRCT2Headless = true;
+
+        std::unique_ptr<IContext> context(CreateContext());
+        if (!context->Initialise())
+        {
+            Console::Error::WriteLine("Context initialization failed.");
+            return EXITCODE_FAIL;
+        }
+
+        DrawingEngineInit();
+
+        if (!context->LoadParkFromFile(inputPath))
+        {
+            DrawingEngineDispose();
+            return EXITCODE_FAIL;
+        }
+
+        gLegacyScene = LegacyScene::playing;
+
+        // Ensure sprites appear regardless of rotation
+        ResetAllSpriteQuadrantPlacements();
+
+        X8DrawingEngine drawingEngine(context->GetUiContext());
+        std::vector<PaletteIndex> bits(static_cast<size_t>(kBenchPaintWidth) * kBenchPaintHeight);
+
+        RenderTarget rt;
+        rt.bits = bits.data();
+        rt.width = kBenchPaintWidth;
+        rt.height = kBenchPaintHeight;
+        rt.DrawingEngine = &drawingEngine;
+
+        Console::WriteLine("Painting %dx%d viewports, %d iterations each...", kBenchPaintWidth, kBenchPaintHeight, iterations);
+
+        double totalMs = 0;
+        uint64_t totalPaintEntries = 0;
+        for (int8_t zoom = 0; zoom <= kBenchPaintMaxZoom; zoom++)
+        {
+            for (uint8_t rotation = 0; rotation < 4; rotation++)
+            {
+                const auto viewport = GetBenchPaintViewport(rotation, ZoomLevel{ zoom });
+
+                uint64_t paintEntries = 0;
+                drawingEngine.BeginDraw();
+                Timer timer;
+                for (int32_t i = 0; i < iterations; i++)
+                {
+                    ViewportRender(rt, &viewport);
+                    paintEntries += ViewportGetLastPaintEntryCount();
+                }
+                const double elapsedMs = timer.GetElapsedTime().count() * 1000.0;
+                drawingEngine.EndDraw();
+
+                Console::WriteLine(
+                    "zoom %d, rotation %d: %.3f ms/frame, %llu paint structs/frame, %.1f paint structs/ms", zoom, rotation,
+                    elapsedMs / iterations, static_cast<unsigned long long>(paintEntries / iterations),
+                    elapsedMs > 0 ? paintEntries / elapsedMs : 0.0);
+
+                totalMs += elapsedMs;
+                totalPaintEntries += paintEntries;
+            }
+        }
+
+        Console::WriteLine(
+            "Total: %.2f ms, %llu paint structs, %.1f paint structs/ms", totalMs,
+            static_cast<unsigned long long>(totalPaintEntries), totalMs > 0 ? totalPaintEntries / totalMs : 0.0);
+
+        DrawingEngineDispose();
+        return EXITCODE_OK;
+    }
+} // namespace OpenRCT2
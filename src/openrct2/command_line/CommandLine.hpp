@@ -118,6 +118,9 @@ namespace OpenRCT2
         }
         extern const CommandLineCommand kSimulateCommands[];
         extern const CommandLineCommand kParkInfoCommands[];
+        extern const CommandLineCommand kBenchPaintCommands[];
+        extern const CommandLineCommand kGenerateMapCommands[];
+        extern const CommandLineCommand kReplayCommands[];
 
         extern const CommandLineExample kRootExamples[];
 
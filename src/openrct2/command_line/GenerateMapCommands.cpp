@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/Path.hpp"
+#include "../core/Timer.hpp"
+#include "../park/ParkFile.h"
+#include "../world/Map.h"
+#include "../world/MapLimits.h"
+#include "../world/map_generator/MapGen.h"
+#include "CommandLine.hpp"
+
+#include <memory>
+
+namespace OpenRCT2
+{
+    static bool _noTrees = false;
+
+    // clang-format off
+    static constexpr CommandLineOptionDefinition kGenerateMapOptions[]
+    {
+        { CMDLINE_TYPE_SWITCH, &_noTrees, kNAC, "no-trees", "do not place trees on the generated map" },
+        kOptionTableEnd
+    };
+
+    static exitcode_t HandleGenerateMap(CommandLineArgEnumerator* argEnumerator);
+
+    const CommandLineCommand CommandLine::kGenerateMapCommands[]{
+        // Main commands
+        DefineCommand("", "<park file> <size> [seed] [output park file]", kGenerateMapOptions, HandleGenerateMap),
+        kCommandTableEnd
+    };
+    // clang-format on
+
+    static exitcode_t HandleGenerateMap(CommandLineArgEnumerator* argEnumerator)
+    {
+        // The park is only used for its objects, its map is replaced by the generated one.
+        const utf8* inputPath;
+        if (!argEnumerator->TryPopString(&inputPath))
+        {
+            Console::Error::WriteLine("Expected a save file path");
+            return EXITCODE_FAIL;
+        }
+
+        int32_t size;
+        if (!argEnumerator->TryPopInteger(&size))
+        {
+            Console::Error::WriteLine("Expected a map size");
+            return EXITCODE_FAIL;
+        }
+        if (size < kMinimumMapSizeTechnical || size > kMaximumMapSizeTechnical)
+        {
+            Console::Error::WriteLine(
+                "Expected a map size between %d and %d", kMinimumMapSizeTechnical, kMaximumMapSizeTechnical);
+            return EXITCODE_FAIL;
+        }
+
+        int32_t seed;
+        if (!argEnumerator->TryPopInteger(&seed))
+        {
+            seed = 0;
+        }
+
+        const utf8* outputPath = nullptr;
+        argEnumerator->TryPopString(&outputPath);
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+
+        std::unique_ptr<IContext> context(CreateContext());
+        if (!context->Initialise())
+        {
+            Console::Error::WriteLine("Context initialization failed.");
+            return EXITCODE_FAIL;
+        }
+
+        if (!context->LoadParkFromFile(inputPath))
+        {
+            return EXITCODE_FAIL;
+        }
+
+        World::MapGenerator::Settings settings{};
+        settings.algorithm = World::MapGenerator::Algorithm::simplexNoise;
+        settings.mapSize = { size, size };
+        settings.seed = static_cast<uint32_t>(seed);
+        settings.trees = !_noTrees;
+
+        Timer timer;
+        World::MapGenerator::generate(&settings);
+        const double elapsedMs = timer.GetElapsedTime().count() * 1000.0;
+
+        Console::WriteLine(
+            "Generated %dx%d map with seed %d in %.2f ms (%zu tile elements)", size, size, seed, elapsedMs,
+            GetTileElementCount());
+
+        if (outputPath != nullptr)
+        {
+            try
+            {
+                auto exporter = std::make_unique<ParkFileExporter>();
+                exporter->Export(getGameState(), Path::GetAbsolute(outputPath), kParkFileSaveCompressionLevel);
+            }
+            catch (const std::exception& ex)
+            {
+                Console::Error::WriteLine(ex.what());
+                return EXITCODE_FAIL;
+            }
+        }
+        return EXITCODE_OK;
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,257 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/FileScanner.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../platform/Platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace OpenRCT2
+{
+    static int32_t _verifyJobs = 0;
+    static u8string _userDataPath = {};
+    static u8string _openrct2DataPath = {};
+    static u8string _rct1DataPath = {};
+    static u8string _rct2DataPath = {};
+
+    // clang-format off
+    static constexpr CommandLineOptionDefinition kReplayVerifyOptions[]
+    {
+        { CMDLINE_TYPE_INTEGER, &_verifyJobs,       'j', "jobs",               "number of replays to verify at once, defaults to the number of cores" },
+        { CMDLINE_TYPE_STRING,  &_userDataPath,     kNAC, "user-data-path",     "path to the user data directory (containing config.ini)"    },
+        { CMDLINE_TYPE_STRING,  &_openrct2DataPath, kNAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+        { CMDLINE_TYPE_STRING,  &_rct1DataPath,     kNAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
+        { CMDLINE_TYPE_STRING,  &_rct2DataPath,     kNAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+        kOptionTableEnd
+    };
+
+    static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator);
+
+    const CommandLineCommand CommandLine::kReplayCommands[]{
+        // Main commands
+        DefineCommand("verify", "<replay file or directory>", kReplayVerifyOptions, HandleReplayVerify),
+        kCommandTableEnd
+    };
+    // clang-format on
+
+    // Workers print their result after this prefix, so it can be told apart from the log output.
+    static constexpr std::string_view kVerifyResultPrefix = "Replay verification result: ";
+
+    struct ReplayVerifyResult
+    {
+        std::string path;
+        bool passed{};
+        std::string message;
+    };
+
+    static ReplayVerifyResult VerifyReplay(const std::string& path)
+    {
+        ReplayVerifyResult result;
+        result.path = path;
+
+        std::unique_ptr<IContext> context(CreateContext());
+        if (!context->Initialise())
+        {
+            result.message = "context initialisation failed";
+            return result;
+        }
+
+        auto* replayManager = context->GetReplayManager();
+        try
+        {
+            replayManager->StartPlayback(path);
+        }
+        catch (const std::exception& e)
+        {
+            result.message = e.what();
+            return result;
+        }
+
+        while (replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching())
+        {
+            gameStateUpdateLogic();
+        }
+
+        auto mismatchTick = replayManager->GetPlaybackMismatchTick();
+        if (mismatchTick.has_value())
+        {
+            result.message = String::stdFormat("mismatch at tick %u", *mismatchTick);
+            return result;
+        }
+
+        result.passed = true;
+        result.message = "ok";
+        return result;
+    }
+
+    /**
+     * Verifies the replay in a separate process, as replays can only be played one at a time in a process.
+     */
+    static ReplayVerifyResult VerifyReplayInWorker(const std::string& path)
+    {
+        const auto executablePath = Platform::GetCurrentExecutablePath();
+        std::vector<const char*> args = { executablePath.c_str(), "replay", "verify", path.c_str() };
+
+        // The worker has to use the same data as this process.
+        const std::pair<const char*, const u8string&> dataPaths[] = {
+            { "--user-data-path", gCustomUserDataPath },
+            { "--openrct2-data-path", gCustomOpenRCT2DataPath },
+            { "--rct1-data-path", gCustomRCT1DataPath },
+            { "--rct2-data-path", gCustomRCT2DataPath },
+        };
+        for (const auto& [option, value] : dataPaths)
+        {
+            if (!value.empty())
+            {
+                args.push_back(option);
+                args.push_back(value.c_str());
+            }
+        }
+        args.push_back(nullptr);
+
+        std::string output;
+        Platform::Execute(args.data(), &output);
+
+        ReplayVerifyResult result;
+        result.path = path;
+        auto resultPos = output.rfind(kVerifyResultPrefix);
+        if (resultPos == std::string::npos)
+        {
+            result.message = "worker process did not report a result";
+            return result;
+        }
+
+        auto line = output.substr(resultPos + kVerifyResultPrefix.size());
+        line = line.substr(0, line.find('\n'));
+        result.passed = line == "ok";
+        result.message = line;
+        return result;
+    }
+
+    static std::vector<std::string> GetReplayFiles(const std::string& path)
+    {
+        std::vector<std::string> files;
+        if (!Path::DirectoryExists(path))
+        {
+            files.push_back(path);
+            return files;
+        }
+
+        auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.parkrep"), true);
+        while (scanner->Next())
+        {
+            files.emplace_back(scanner->GetPath());
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator)
+    {
+        const utf8* rawPath;
+        if (!argEnumerator->TryPopString(&rawPath))
+        {
+            Console::Error::WriteLine("Expected a replay file or directory");
+            return EXITCODE_FAIL;
+        }
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+
+        // The options of the root command are not parsed for sub commands.
+        if (!_userDataPath.empty())
+        {
+            gCustomUserDataPath = Path::GetAbsolute(_userDataPath);
+        }
+        if (!_openrct2DataPath.empty())
+        {
+            gCustomOpenRCT2DataPath = Path::GetAbsolute(_openrct2DataPath);
+        }
+        if (!_rct1DataPath.empty())
+        {
+            gCustomRCT1DataPath = Path::GetAbsolute(_rct1DataPath);
+        }
+        if (!_rct2DataPath.empty())
+        {
+            gCustomRCT2DataPath = Path::GetAbsolute(_rct2DataPath);
+        }
+
+#ifdef DISABLE_NETWORK
+        Console::Error::WriteLine("Checksums are not compared in builds without networking, only commands are replayed.");
+#endif
+
+        const auto files = GetReplayFiles(Path::GetAbsolute(rawPath));
+        if (files.empty())
+        {
+            Console::Error::WriteLine("No replays found");
+            return EXITCODE_FAIL;
+        }
+#ifdef _WIN32
+        // Platform::Execute is not available to verify the other replays in worker processes.
+        if (files.size() > 1)
+        {
+            Console::Error::WriteLine("Found %zu replays, only one replay can be verified at a time on Windows", files.size());
+            return EXITCODE_FAIL;
+        }
+#endif
+
+        std::vector<ReplayVerifyResult> results(files.size());
+        if (files.size() == 1)
+        {
+            results[0] = VerifyReplay(files[0]);
+            Console::WriteLine("%s%s", std::string(kVerifyResultPrefix).c_str(), results[0].message.c_str());
+        }
+        else
+        {
+            const auto jobs = _verifyJobs > 0 ? static_cast<size_t>(_verifyJobs)
+                                              : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            std::atomic<size_t> nextFile{};
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < std::min(jobs, files.size()); i++)
+            {
+                workers.emplace_back([&] {
+                    size_t index;
+                    while ((index = nextFile++) < files.size())
+                    {
+                        results[index] = VerifyReplayInWorker(files[index]);
+                    }
+                });
+            }
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        size_t failed = 0;
+        for (const auto& result : results)
+        {
+            Console::WriteLine("%s: %s", result.path.c_str(), result.message.c_str());
+            if (!result.passed)
+                failed++;
+        }
+        Console::WriteLine("Verified %zu replays, %zu failed", results.size(), failed);
+        return failed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+    }
+} // namespace OpenRCT2
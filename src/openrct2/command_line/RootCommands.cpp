@@ -146,6 +146,9 @@ namespace OpenRCT2
         DefineSubCommand("sprite",          Sprite::kSpriteCommands   ),
         DefineSubCommand("simulate",        kSimulateCommands         ),
         DefineSubCommand("parkinfo",        kParkInfoCommands         ),
+        DefineSubCommand("bench-paint",     kBenchPaintCommands       ),
+        DefineSubCommand("generate-map",    kGenerateMapCommands      ),
+        DefineSubCommand("replay",          kReplayCommands           ),
         kCommandTableEnd
     };
 
@@ -199,6 +202,7 @@ namespace OpenRCT2
 
         gOpenRCT2Headless = _headless;
         gOpenRCT2NoGraphics = _headless;
+        gOpenRCT2NoPresentation = _headless;
         gOpenRCT2SilentBreakpad = _silentBreakpad || _headless;
 
         if (!_userDataPath.empty())
@@ -13,6 +13,7 @@
 #include "../OpenRCT2.h"
 #include "../config/ConfigTypes.h"
 #include "../core/Console.hpp"
+#include "../core/Timer.hpp"
 #include "../entity/EntityRegistry.h"
 #include "../network/Network.h"
 #include "../platform/Platform.h"
@@ -23,9 +24,12 @@
 
 namespace OpenRCT2
 {
+    static bool _withPresentation = false;
+
     // clang-format off
-    static constexpr CommandLineOptionDefinition kNoOptions[]
+    static constexpr CommandLineOptionDefinition kSimulateOptions[]
     {
+        { CMDLINE_TYPE_SWITCH, &_withPresentation, kNAC, "with-presentation", "keep presentation work (invalidation, sounds) enabled, for benchmarking" },
         kOptionTableEnd
     };
 
@@ -33,7 +37,7 @@ namespace OpenRCT2
 
     const CommandLineCommand CommandLine::kSimulateCommands[]{
         // Main commands
-        DefineCommand("", "<park file> <ticks>", kNoOptions, HandleSimulate),
+        DefineCommand("", "<park file> <ticks>", kSimulateOptions, HandleSimulate),
         kCommandTableEnd
     };
     // clang-format on
@@ -55,6 +59,7 @@ namespace OpenRCT2
         }
 
         gOpenRCT2Headless = true;
+        gOpenRCT2NoPresentation = !_withPresentation;
 
 #ifndef DISABLE_NETWORK
         gNetworkStart = Network::Mode::server;
@@ -69,11 +74,16 @@ namespace OpenRCT2
             }
 
             Console::WriteLine("Running %d ticks...", ticks);
+            Timer timer;
             for (int32_t i = 0; i < ticks; i++)
             {
                 gameStateUpdateLogic();
             }
+            const auto elapsedMs = timer.GetElapsedTime().count() * 1000.0f;
             Console::WriteLine("Completed: %s", getGameState().entities.GetAllEntitiesChecksum().ToString().c_str());
+            Console::WriteLine(
+                "Simulated %d ticks in %.2f ms (%.4f ms/tick, presentation %s)", ticks, elapsedMs,
+                ticks > 0 ? elapsedMs / ticks : 0.0f, _withPresentation ? "enabled" : "disabled");
         }
         else
         {
@@ -47,6 +47,8 @@ namespace OpenRCT2::CommandLine::Sprite
             return -1;
         }
 
+        // The images are read from the table directly, rather than being drawn.
+        metaObject->GetImageTable().LoadDeferredImages();
         const auto* imageTableStart = metaObject->GetImageTable().GetImages();
         const uint32_t maxIndex = metaObject->GetNumImages();
         const int32_t numbers = static_cast<int32_t>(std::floor(std::log10(maxIndex) + 1));
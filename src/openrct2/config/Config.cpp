@@ -511,6 +511,7 @@ namespace OpenRCT2::Config
             model->logServerActions = reader->GetBoolean("log_server_actions", false);
             model->pauseServerIfNoClients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desyncDebugging = reader->GetBoolean("desync_debugging", false);
+            model->serverNetworkThread = reader->GetBoolean("server_network_thread", false);
         }
     }
 
@@ -538,6 +539,7 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("log_server_actions", model->logServerActions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pauseServerIfNoClients);
         writer->WriteBoolean("desync_debugging", model->desyncDebugging);
+        writer->WriteBoolean("server_network_thread", model->serverNetworkThread);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -186,6 +186,7 @@ namespace OpenRCT2::Config
         bool logServerActions;
         bool pauseServerIfNoClients;
         bool desyncDebugging;
+        bool serverNetworkThread;
     };
 
     struct Notification
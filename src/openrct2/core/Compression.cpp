@@ -82,7 +82,9 @@ namespace OpenRCT2::Compression
         return true;
     }
 
-    bool zlibDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header)
+    bool zlibDecompress(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header,
+        bool prefixOnly)
     {
         if (sourceLength > source.GetLength() - source.GetPosition())
             throw IOException("Not Enough Data to Decompress");
@@ -108,8 +110,11 @@ namespace OpenRCT2::Compression
             {
                 if (!destBuf)
                 {
-                    LOG_ERROR("Decompressed data larger than expected");
                     inflateEnd(&strm);
+                    if (prefixOnly)
+                        return true;
+
+                    LOG_ERROR("Decompressed data larger than expected");
                     return false;
                 }
 
@@ -221,7 +226,7 @@ namespace OpenRCT2::Compression
         return true;
     }
 
-    bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength)
+    bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, bool prefixOnly)
     {
         if (sourceLength > source.GetLength() - source.GetPosition())
             throw IOException("Not Enough Data to Decompress");
@@ -247,6 +252,9 @@ namespace OpenRCT2::Compression
             {
                 if (!destBuf)
                 {
+                    if (prefixOnly)
+                        return true;
+
                     LOG_ERROR("Decompressed data larger than expected");
                     return false;
                 }
@@ -34,8 +34,10 @@ namespace OpenRCT2::Compression
     bool zlibCompress(
         IStream& source, uint64_t sourceLength, IStream& dest, ZlibHeaderType header,
         int16_t level = kZlibDefaultCompressionLevel);
+    // With prefixOnly set, decompression stops after decompressLength bytes rather than failing if the data is longer.
     bool zlibDecompress(
-        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header);
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header,
+        bool prefixOnly = false);
 
     // Zstd methods, using the ZStandard compression algorithm
     constexpr int16_t kZstdDefaultCompressionLevel = 3;
@@ -53,5 +55,6 @@ namespace OpenRCT2::Compression
     bool zstdCompress(
         IStream& source, uint64_t sourceLength, IStream& dest, ZstdMetadata metadata,
         int16_t level = kZstdDefaultCompressionLevel);
-    bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength);
+    bool zstdDecompress(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, bool prefixOnly = false);
 } // namespace OpenRCT2::Compression
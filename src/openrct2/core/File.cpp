@@ -19,9 +19,12 @@
 #include "../Diagnostic.h"
 #include "../platform/Platform.h"
 #include "File.h"
+#include "FileScanner.h"
 #include "FileStream.h"
+#include "Path.hpp"
 #include "String.hpp"
 
+#include <algorithm>
 #include <fstream>
 
 namespace OpenRCT2::File
@@ -148,4 +151,33 @@ namespace OpenRCT2::File
     {
         return Platform::GetFileSize(path);
     }
+
+    size_t DeleteOldestFiles(u8string_view directory, u8string_view pattern, size_t maxFiles, u8string_view keepPath)
+    {
+        struct FileEntry
+        {
+            u8string path;
+            uint64_t lastModified;
+        };
+
+        std::vector<FileEntry> files;
+        auto scanner = Path::ScanDirectory(Path::Combine(directory, pattern), false);
+        while (scanner->Next())
+        {
+            files.push_back({ scanner->GetPath(), scanner->GetFileInfo().LastModified });
+        }
+
+        std::sort(files.begin(), files.end(), [](const FileEntry& a, const FileEntry& b) {
+            return a.lastModified < b.lastModified;
+        });
+        auto numFiles = files.size();
+        for (const auto& file : files)
+        {
+            if (numFiles <= maxFiles)
+                break;
+            if (file.path != keepPath && Delete(file.path))
+                numFiles--;
+        }
+        return numFiles;
+    }
 } // namespace OpenRCT2::File
@@ -25,4 +25,10 @@ namespace OpenRCT2::File
     void WriteAllBytes(u8string_view path, const void* buffer, size_t length);
     uint64_t GetLastModified(u8string_view path);
     uint64_t GetSize(u8string_view path);
+
+    /**
+     * Deletes the files matching the pattern in the directory that were modified longest ago until no more than maxFiles
+     * are left, but never keepPath. Returns the number of files left.
+     */
+    size_t DeleteOldestFiles(u8string_view directory, u8string_view pattern, size_t maxFiles, u8string_view keepPath);
 } // namespace OpenRCT2::File
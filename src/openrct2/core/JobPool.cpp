@@ -9,6 +9,8 @@
 
 #include "JobPool.h"
 
+#include "../profiling/Profiling.h"
+
 #include <cassert>
 
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
@@ -99,6 +101,8 @@ bool JobPool::IsBusy()
 
 void JobPool::ProcessQueue()
 {
+    OpenRCT2::Profiling::setThreadName("Job pool");
+
     std::unique_lock lock(_mutex);
     do
     {
@@ -84,53 +84,8 @@ namespace OpenRCT2
             _compressionLevel = compressionLevel;
             if (mode == Mode::reading)
             {
-                _header = _stream->ReadValue<Header>();
-
-                _chunks.clear();
-                for (uint32_t i = 0; i < _header.numChunks; i++)
-                {
-                    auto entry = _stream->ReadValue<ChunkEntry>();
-                    _chunks.push_back(entry);
-                }
-
-                // Uncompress
-                if (_header.compression != CompressionType::none)
-                {
-                    bool decompressStatus = false;
-
-                    switch (_header.compression)
-                    {
-                        case CompressionType::gzip:
-                            decompressStatus = Compression::zlibDecompress(
-                                *_stream, _header.compressedSize, _buffer, _header.uncompressedSize,
-                                Compression::ZlibHeaderType::gzip);
-                            break;
-                        case CompressionType::zstd:
-                            decompressStatus = Compression::zstdDecompress(
-                                *_stream, _header.compressedSize, _buffer, _header.uncompressedSize);
-                            break;
-                        default:
-                            throw IOException("Unknown park compression type");
-                    }
-
-                    if (!decompressStatus)
-                        throw IOException("Decompression error!");
-                }
-                else
-                {
-                    if (_header.uncompressedSize != _header.compressedSize)
-                        throw IOException("Compressed and uncompressed sizes don't match!");
-                    _buffer.CopyFromStream(*_stream, _header.uncompressedSize);
-                }
-
-                // early in-dev versions used SHA1 instead of FNV1a, so just assume any file
-                // with a verison number of 0 may be one of these, and don't check their hashes.
-                if (_header.targetVersion > 0)
-                {
-                    auto checksum = Crypt::FNV1a(_buffer.GetData(), _buffer.GetLength());
-                    if (checksum != _header.fnv1a)
-                        throw IOException("Checksum is not valid!");
-                }
+                readHeader();
+                readData(_header.uncompressedSize);
             }
             else
             {
@@ -141,6 +96,36 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Opens the stream for reading only the given chunks. The data is only decompressed up to the end of the last of
+         * them, so chunks near the start of the file can be read without decompressing everything after them. The
+         * checksum can not be verified in that case and any chunk that was not decompressed completely is left out.
+         */
+        OrcaStream(IStream& stream, std::span<const uint32_t> chunkIds)
+        {
+            _stream = &stream;
+            _mode = Mode::reading;
+            _compressionLevel = Compression::kNoCompressionLevel;
+            readHeader();
+
+            uint64_t dataLength = 0;
+            for (const auto& chunk : _chunks)
+            {
+                if (std::find(chunkIds.begin(), chunkIds.end(), chunk.id) != chunkIds.end())
+                {
+                    dataLength = std::max(dataLength, chunk.offset + chunk.length);
+                }
+            }
+            dataLength = std::min(dataLength, _header.uncompressedSize);
+            readData(dataLength);
+
+            _chunks.erase(
+                std::remove_if(
+                    _chunks.begin(), _chunks.end(),
+                    [dataLength](const ChunkEntry& e) { return e.offset + e.length > dataLength; }),
+                _chunks.end());
+        }
+
         OrcaStream(const OrcaStream&) = delete;
 
         ~OrcaStream()
@@ -249,6 +234,62 @@ namespace OpenRCT2
         }
 
     private:
+        void readHeader()
+        {
+            _header = _stream->ReadValue<Header>();
+
+            _chunks.clear();
+            for (uint32_t i = 0; i < _header.numChunks; i++)
+            {
+                auto entry = _stream->ReadValue<ChunkEntry>();
+                _chunks.push_back(entry);
+            }
+        }
+
+        void readData(uint64_t dataLength)
+        {
+            const bool prefixOnly = dataLength < _header.uncompressedSize;
+
+            // Uncompress
+            if (_header.compression != CompressionType::none)
+            {
+                bool decompressStatus = false;
+
+                switch (_header.compression)
+                {
+                    case CompressionType::gzip:
+                        decompressStatus = Compression::zlibDecompress(
+                            *_stream, _header.compressedSize, _buffer, dataLength, Compression::ZlibHeaderType::gzip,
+                            prefixOnly);
+                        break;
+                    case CompressionType::zstd:
+                        decompressStatus = Compression::zstdDecompress(
+                            *_stream, _header.compressedSize, _buffer, dataLength, prefixOnly);
+                        break;
+                    default:
+                        throw IOException("Unknown park compression type");
+                }
+
+                if (!decompressStatus)
+                    throw IOException("Decompression error!");
+            }
+            else
+            {
+                if (_header.uncompressedSize != _header.compressedSize)
+                    throw IOException("Compressed and uncompressed sizes don't match!");
+                _buffer.CopyFromStream(*_stream, dataLength);
+            }
+
+            // early in-dev versions used SHA1 instead of FNV1a, so just assume any file
+            // with a verison number of 0 may be one of these, and don't check their hashes.
+            if (_header.targetVersion > 0 && !prefixOnly)
+            {
+                auto checksum = Crypt::FNV1a(_buffer.GetData(), _buffer.GetLength());
+                if (checksum != _header.fnv1a)
+                    throw IOException("Checksum is not valid!");
+            }
+        }
+
         bool seekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.id == id; });
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace OpenRCT2
+{
+    /**
+     * An unbounded lock-free queue for passing values from exactly one producer thread to exactly one consumer thread.
+     */
+    template<typename T>
+    class SpscQueue
+    {
+    private:
+        struct Node
+        {
+            std::atomic<Node*> next{};
+            std::optional<T> value;
+        };
+
+        // The consumer owns the head, which is always a node whose value has already been taken. The producer owns the
+        // tail. Starting with the stub node keeps construction free of allocations.
+        Node _stub;
+        Node* _head = &_stub;
+        Node* _tail = &_stub;
+
+    public:
+        SpscQueue() noexcept = default;
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        ~SpscQueue()
+        {
+            auto* node = _head;
+            while (node != nullptr)
+            {
+                auto* next = node->next.load(std::memory_order_relaxed);
+                if (node != &_stub)
+                {
+                    delete node;
+                }
+                node = next;
+            }
+        }
+
+        // Must only be called from the producer thread.
+        void push(T value)
+        {
+            auto* node = new Node();
+            node->value.emplace(std::move(value));
+            _tail->next.store(node, std::memory_order_release);
+            _tail = node;
+        }
+
+        // Must only be called from the consumer thread.
+        bool pop(T& value)
+        {
+            auto* next = _head->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return false;
+            }
+
+            value = std::move(*next->value);
+            next->value.reset();
+            if (_head != &_stub)
+            {
+                delete _head;
+            }
+            _head = next;
+            return true;
+        }
+    };
+} // namespace OpenRCT2
@@ -9,6 +9,7 @@
 
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "LightFX.h"
 #include "PaletteIndex.h"
 
 using OpenRCT2::Drawing::PaletteIndex;
@@ -44,6 +45,268 @@ void MaskAvx2(
     }
 }
 
+// Gathers every (1 << TZoom)th pixel of the next 32 << TZoom run pixels, see GatherRLERunSse4_1. The packs work on
+// each 128-bit lane separately, so the pixels have to be put back in order afterwards.
+template<int32_t TZoom>
+static __m256i GatherRLERunAvx2(const PaletteIndex* src)
+{
+    const auto* p = reinterpret_cast<const __m256i*>(src);
+    if constexpr (TZoom == 0)
+    {
+        return _mm256_loadu_si256(p);
+    }
+    else if constexpr (TZoom == 1)
+    {
+        const __m256i mask = _mm256_set1_epi16(0xFF);
+        const __m256i a = _mm256_and_si256(_mm256_loadu_si256(p), mask);
+        const __m256i b = _mm256_and_si256(_mm256_loadu_si256(p + 1), mask);
+        return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+    }
+    else if constexpr (TZoom == 2)
+    {
+        const __m256i mask = _mm256_set1_epi32(0xFF);
+        const __m256i a = _mm256_and_si256(_mm256_loadu_si256(p), mask);
+        const __m256i b = _mm256_and_si256(_mm256_loadu_si256(p + 1), mask);
+        const __m256i c = _mm256_and_si256(_mm256_loadu_si256(p + 2), mask);
+        const __m256i d = _mm256_and_si256(_mm256_loadu_si256(p + 3), mask);
+        const __m256i packed = _mm256_packus_epi16(_mm256_packus_epi32(a, b), _mm256_packus_epi32(c, d));
+        return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    }
+    else
+    {
+        const __m256i mask = _mm256_set1_epi64x(0xFF);
+        __m256i quarters[4];
+        for (int32_t i = 0; i < 4; i++)
+        {
+            const __m256i a = _mm256_and_si256(_mm256_loadu_si256(p + i * 2), mask);
+            const __m256i b = _mm256_and_si256(_mm256_loadu_si256(p + i * 2 + 1), mask);
+            quarters[i] = _mm256_packus_epi32(a, b);
+        }
+        const __m256i packed = _mm256_packus_epi16(
+            _mm256_packus_epi32(quarters[0], quarters[1]), _mm256_packus_epi32(quarters[2], quarters[3]));
+        // Each 16-bit element now holds two pixels, with the first half of every group of four in the low lane.
+        const __m256i halves = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256i interleave = _mm256_setr_epi8(
+            0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15, 0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+        return _mm256_shuffle_epi8(halves, interleave);
+    }
+}
+
+namespace
+{
+    // See PaletteLookupSse4_1, pshufb looks up each 128-bit lane in the same 16 byte table.
+    struct PaletteLookupAvx2
+    {
+        __m256i lo[8];
+        __m256i hi[8];
+
+        explicit PaletteLookupAvx2(const PaletteIndex* paletteMap)
+        {
+            __m128i prevLo = {};
+            __m128i prevHi = {};
+            for (int32_t i = 0; i < 8; i++)
+            {
+                const __m128i curLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + i * 16));
+                const __m128i curHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + 128 + i * 16));
+                lo[i] = _mm256_broadcastsi128_si256(_mm_xor_si128(curLo, prevLo));
+                hi[i] = _mm256_broadcastsi128_si256(_mm_xor_si128(curHi, prevHi));
+                prevLo = curLo;
+                prevHi = curHi;
+            }
+        }
+
+        __m256i Lookup(__m256i index) const
+        {
+            const __m256i step = _mm256_set1_epi8(16);
+            __m256i indexLo = index;
+            __m256i indexHi = _mm256_xor_si256(index, _mm256_set1_epi8(static_cast<char>(0x80)));
+            __m256i resultLo = {};
+            __m256i resultHi = {};
+            for (int32_t i = 0; i < 8; i++)
+            {
+                resultLo = _mm256_xor_si256(resultLo, _mm256_shuffle_epi8(lo[i], indexLo));
+                resultHi = _mm256_xor_si256(resultHi, _mm256_shuffle_epi8(hi[i], indexHi));
+                indexLo = _mm256_sub_epi8(indexLo, step);
+                indexHi = _mm256_sub_epi8(indexHi, step);
+            }
+            return _mm256_blendv_epi8(resultLo, resultHi, index);
+        }
+    };
+} // namespace
+
+template<int32_t TZoom, typename TBlockOp>
+static int32_t ProcessRLERunAvx2(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, TBlockOp op)
+{
+    constexpr int32_t kBlockPixels = 32 << TZoom;
+    int32_t i = 0;
+    for (; i + kBlockPixels <= numPixels; i += kBlockPixels, dst += 32)
+    {
+        const __m256i pixels = GatherRLERunAvx2<TZoom>(src + i);
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), op(pixels, dest));
+    }
+    return i;
+}
+
+template<typename TBlockOp>
+static int32_t ProcessRLERunAvx2(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift, TBlockOp op)
+{
+    switch (zoomShift)
+    {
+        case 0:
+            return ProcessRLERunAvx2<0>(dst, src, numPixels, op);
+        case 1:
+            return ProcessRLERunAvx2<1>(dst, src, numPixels, op);
+        case 2:
+            return ProcessRLERunAvx2<2>(dst, src, numPixels, op);
+        default:
+            return ProcessRLERunAvx2<3>(dst, src, numPixels, op);
+    }
+}
+
+// The tail of a run that does not fill a whole 32 pixel block is still worth doing 16 pixels at a time.
+void CopyRLERunAvx2(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift)
+{
+    const __m256i zero = {};
+    const int32_t done = ProcessRLERunAvx2(dst, src, numPixels, zoomShift, [zero](__m256i pixels, __m256i dest) {
+        return _mm256_blendv_epi8(pixels, dest, _mm256_cmpeq_epi8(pixels, zero));
+    });
+    CopyRLERunSse4_1(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift);
+}
+
+void RemapRLERunAvx2(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    // Shorter runs are not worth building the lookup tables for, see RemapRLERunSse4_1.
+    int32_t done = 0;
+    if ((numPixels >> zoomShift) >= 32)
+    {
+        const __m256i zero = {};
+        const PaletteLookupAvx2 lookup(paletteMap);
+        done = ProcessRLERunAvx2(dst, src, numPixels, zoomShift, [&](__m256i pixels, __m256i dest) {
+            const __m256i remapped = lookup.Lookup(pixels);
+            const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(pixels, zero), _mm256_cmpeq_epi8(remapped, zero));
+            return _mm256_blendv_epi8(remapped, dest, keep);
+        });
+    }
+    RemapRLERunScalar(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift, paletteMap);
+}
+
+void GlassRLERunAvx2(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    int32_t done = 0;
+    if ((numPixels >> zoomShift) >= 32)
+    {
+        const __m256i zero = {};
+        const PaletteLookupAvx2 lookup(paletteMap);
+        done = ProcessRLERunAvx2(dst, src, numPixels, zoomShift, [&](__m256i pixels, __m256i dest) {
+            const __m256i remapped = lookup.Lookup(dest);
+            const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(pixels, zero), _mm256_cmpeq_epi8(remapped, zero));
+            return _mm256_blendv_epi8(remapped, dest, keep);
+        });
+    }
+    GlassRLERunScalar(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift, paletteMap);
+}
+
+void RemapRectAvx2(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    if (width < 32 || width * height < 64)
+    {
+        RemapRectSse4_1(dst, width, height, dstWrap, paletteMap);
+        return;
+    }
+
+    const PaletteLookupAvx2 lookup(paletteMap);
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 32 <= width; xx += 32)
+        {
+            auto* block = reinterpret_cast<__m256i*>(dst + xx);
+            _mm256_storeu_si256(block, lookup.Lookup(_mm256_loadu_si256(block)));
+        }
+        if (xx + 16 <= width)
+        {
+            // Both lanes use the same tables, so a 16 pixel tail can be looked up in the lower lane alone.
+            auto* block = reinterpret_cast<__m128i*>(dst + xx);
+            const __m256i remapped = lookup.Lookup(_mm256_castsi128_si256(_mm_loadu_si128(block)));
+            _mm_storeu_si128(block, _mm256_castsi256_si128(remapped));
+            xx += 16;
+        }
+        RemapRectScalar(dst + xx, width - xx, 1, 0, paletteMap);
+        dst += width + dstWrap;
+    }
+}
+
+namespace OpenRCT2::Drawing::LightFx
+{
+    void AccumulateLightAvx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity)
+    {
+        uint32_t x = 0;
+        if (intensity == 0xFF)
+        {
+            for (; x + 32 <= count; x += 32)
+            {
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+                const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + x));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_adds_epu8(d, s));
+            }
+        }
+        else
+        {
+            // (src * (1 + intensity)) >> 8 fits in 16 bits, so widen to 16 bits, scale and narrow again.
+            const __m256i zero = {};
+            const __m256i scale = _mm256_set1_epi16(static_cast<int16_t>(1 + intensity));
+            for (; x + 32 <= count; x += 32)
+            {
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+                const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + x));
+                const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), scale), 8);
+                const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), scale), 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_adds_epu8(d, _mm256_packus_epi16(lo, hi)));
+            }
+        }
+        AccumulateLightScalar(dst + x, src + x, count - x, intensity);
+    }
+
+    void MixLightRowAvx2(
+        uint32_t* RESTRICT dst, const PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette)
+    {
+        // See MixLightRowSse4_1, the unpacks and packs below all work within 128-bit lanes so pixels keep their order.
+        const __m256i zero = {};
+        const __m256i six = _mm256_set1_epi16(6);
+        const __m256i broadcast = _mm256_set1_epi32(0x01010101);
+        const auto* darkBase = reinterpret_cast<const int*>(palette);
+        const auto* lightBase = reinterpret_cast<const int*>(lightPalette);
+        uint32_t x = 0;
+        for (; x + 8 <= count; x += 8)
+        {
+            const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(bits + x)));
+            const __m256i dark = _mm256_i32gather_epi32(darkBase, index, 4);
+            const __m256i light = _mm256_i32gather_epi32(lightBase, index, 4);
+
+            const __m256i intensity = _mm256_mullo_epi32(
+                _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(lightBits + x))), broadcast);
+
+            const __m256i scaleLo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(intensity, zero), six);
+            const __m256i scaleHi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(intensity, zero), six);
+            const __m256i lightLo = _mm256_mulhi_epu16(_mm256_unpacklo_epi8(zero, light), scaleLo);
+            const __m256i lightHi = _mm256_mulhi_epu16(_mm256_unpackhi_epi8(zero, light), scaleHi);
+            const __m256i mixedLo = _mm256_add_epi16(_mm256_unpacklo_epi8(dark, zero), lightLo);
+            const __m256i mixedHi = _mm256_add_epi16(_mm256_unpackhi_epi8(dark, zero), lightHi);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_packus_epi16(mixedLo, mixedHi));
+        }
+        MixLightRowScalar(dst + x, bits + x, lightBits + x, count - x, palette, lightPalette);
+    }
+} // namespace OpenRCT2::Drawing::LightFx
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -57,4 +320,44 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void CopyRLERunAvx2(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void RemapRLERunAvx2(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void GlassRLERunAvx2(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void RemapRectAvx2(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+namespace OpenRCT2::Drawing::LightFx
+{
+    void AccumulateLightAvx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity)
+    {
+        OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+    }
+
+    void MixLightRowAvx2(
+        uint32_t* RESTRICT dst, const PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette)
+    {
+        OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+    }
+} // namespace OpenRCT2::Drawing::LightFx
+
 #endif // __AVX2__
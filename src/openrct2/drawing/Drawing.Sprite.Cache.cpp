@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Drawing.Sprite.h"
+
+#include <array>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+using namespace OpenRCT2;
+
+namespace
+{
+    // Viewports are painted by several jobs at once, so the cache is split into shards with their own lock and share of
+    // the memory budget to keep the threads from queueing on a single mutex.
+    constexpr size_t kDecimatedSpriteCacheShards = 16;
+    constexpr size_t kDecimatedSpriteCacheBudget = 32 * 1024 * 1024;
+    constexpr size_t kDecimatedSpriteShardBudget = kDecimatedSpriteCacheBudget / kDecimatedSpriteCacheShards;
+
+    struct DecimatedSpriteEntry
+    {
+        uint64_t key{};
+        // The element the sprite was decimated from, an image index can be reused for a different sprite.
+        const uint8_t* source{};
+        std::shared_ptr<const std::vector<uint8_t>> data;
+    };
+
+    struct DecimatedSpriteShard
+    {
+        std::mutex mutex;
+        // Most recently used first.
+        std::list<DecimatedSpriteEntry> entries;
+        std::unordered_map<uint64_t, std::list<DecimatedSpriteEntry>::iterator> lookup;
+        size_t memoryUsage{};
+
+        void Erase(std::list<DecimatedSpriteEntry>::iterator it)
+        {
+            memoryUsage -= it->data->size();
+            lookup.erase(it->key);
+            entries.erase(it);
+        }
+    };
+
+    std::array<DecimatedSpriteShard, kDecimatedSpriteCacheShards> _decimatedSpriteShards;
+} // namespace
+
+static uint64_t GetDecimatedSpriteKey(ImageIndex imageId, int32_t zoomShift)
+{
+    return (static_cast<uint64_t>(imageId) << 2) | static_cast<uint64_t>(zoomShift - 1);
+}
+
+static DecimatedSpriteShard& GetDecimatedSpriteShard(ImageIndex imageId)
+{
+    return _decimatedSpriteShards[imageId % kDecimatedSpriteCacheShards];
+}
+
+/**
+ * Keeps every line of the RLE sprite but only the columns that are sampled when drawing it at the given zoom level, which
+ * are the multiples of the zoom. Runs keep the g1 layout so the result can be drawn like any other RLE sprite.
+ */
+static std::vector<uint8_t> DecimateRLESprite(const G1Element& g1, int32_t zoomShift)
+{
+    const int32_t zoom = 1 << zoomShift;
+    const auto height = static_cast<size_t>(g1.height);
+
+    // A line never grows, so the line offsets still fit in 16 bits.
+    std::vector<uint8_t> result(height * sizeof(uint16_t));
+    for (size_t y = 0; y < height; y++)
+    {
+        const auto lineOffset = static_cast<uint16_t>(result.size());
+        std::memcpy(&result[y * sizeof(uint16_t)], &lineOffset, sizeof(uint16_t));
+
+        uint16_t srcLineOffset;
+        std::memcpy(&srcLineOffset, &g1.offset[y * sizeof(uint16_t)], sizeof(uint16_t));
+        const uint8_t* src = g1.offset + srcLineOffset;
+
+        size_t lastRunHeader = 0;
+        bool hasRun = false;
+        bool isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            const int32_t dataSize = src[0] & 0x7F;
+            const int32_t firstPixelX = src[1];
+            isEndOfLine = (src[0] & 0x80) != 0;
+
+            const int32_t first = (firstPixelX + zoom - 1) >> zoomShift;
+            const int32_t last = (firstPixelX + dataSize + zoom - 1) >> zoomShift;
+            if (last > first)
+            {
+                lastRunHeader = result.size();
+                hasRun = true;
+                result.push_back(static_cast<uint8_t>(last - first));
+                result.push_back(static_cast<uint8_t>(first));
+                for (int32_t x = first; x < last; x++)
+                {
+                    result.push_back(src[2 + (x << zoomShift) - firstPixelX]);
+                }
+            }
+            src += 2 + dataSize;
+        }
+
+        if (hasRun)
+        {
+            result[lastRunHeader] |= 0x80;
+        }
+        else
+        {
+            // Every line needs at least one run to mark its end.
+            result.push_back(0x80);
+            result.push_back(0);
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> GfxGetDecimatedSprite(ImageIndex imageId, const G1Element& g1, int32_t zoomShift)
+{
+    const auto key = GetDecimatedSpriteKey(imageId, zoomShift);
+    auto& shard = GetDecimatedSpriteShard(imageId);
+    {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.lookup.find(key);
+        if (it != shard.lookup.end())
+        {
+            if (it->second->source == g1.offset)
+            {
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                return it->second->data;
+            }
+            shard.Erase(it->second);
+        }
+    }
+
+    // Decimate outside of the lock, if another thread got there first its copy is simply replaced.
+    auto data = std::make_shared<const std::vector<uint8_t>>(DecimateRLESprite(g1, zoomShift));
+
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.lookup.find(key);
+    if (it != shard.lookup.end())
+    {
+        shard.Erase(it->second);
+    }
+    while (!shard.entries.empty() && shard.memoryUsage + data->size() > kDecimatedSpriteShardBudget)
+    {
+        shard.Erase(std::prev(shard.entries.end()));
+    }
+    shard.entries.push_front({ key, g1.offset, data });
+    shard.lookup.emplace(key, shard.entries.begin());
+    shard.memoryUsage += data->size();
+    return data;
+}
+
+void GfxInvalidateDecimatedSprite(ImageIndex imageId)
+{
+    auto& shard = GetDecimatedSpriteShard(imageId);
+    std::lock_guard lock(shard.mutex);
+    if (shard.entries.empty())
+        return;
+
+    for (int32_t zoomShift = 1; zoomShift <= 3; zoomShift++)
+    {
+        auto it = shard.lookup.find(GetDecimatedSpriteKey(imageId, zoomShift));
+        if (it != shard.lookup.end())
+        {
+            shard.Erase(it->second);
+        }
+    }
+}
+
+void GfxClearDecimatedSprites()
+{
+    for (auto& shard : _decimatedSpriteShards)
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.entries.clear();
+        shard.lookup.clear();
+        shard.memoryUsage = 0;
+    }
+}
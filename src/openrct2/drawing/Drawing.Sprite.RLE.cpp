@@ -9,11 +9,135 @@
 
 #include "Drawing.Sprite.h"
 
+#include "../Diagnostic.h"
+#include "../core/EnumUtils.hpp"
+#include "../platform/Platform.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+void CopyRLERunScalar(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift)
+{
+    const int32_t zoom = 1 << zoomShift;
+    for (int32_t i = 0; i < numPixels; i += zoom, dst++)
+    {
+        const auto pixel = src[i];
+        if (pixel != PaletteIndex::transparent)
+            *dst = pixel;
+    }
+}
+
+void RemapRLERunScalar(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    const int32_t zoom = 1 << zoomShift;
+    for (int32_t i = 0; i < numPixels; i += zoom, dst++)
+    {
+        if (src[i] == PaletteIndex::transparent)
+            continue;
+        const auto pixel = paletteMap[EnumValue(src[i])];
+        if (pixel != PaletteIndex::transparent)
+            *dst = pixel;
+    }
+}
+
+void GlassRLERunScalar(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    const int32_t zoom = 1 << zoomShift;
+    for (int32_t i = 0; i < numPixels; i += zoom, dst++)
+    {
+        if (src[i] == PaletteIndex::transparent)
+            continue;
+        const auto pixel = paletteMap[EnumValue(*dst)];
+        if (pixel != PaletteIndex::transparent)
+            *dst = pixel;
+    }
+}
+
+void BlendRLERunScalar(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    // Same indexing as PaletteMap::Blend, there is no table for a transparent source.
+    const int32_t zoom = 1 << zoomShift;
+    for (int32_t i = 0; i < numPixels; i += zoom, dst++)
+    {
+        if (src[i] == PaletteIndex::transparent)
+            continue;
+        const auto pixel = paletteMap[((EnumValue(src[i]) - 1) * 256) + EnumValue(*dst)];
+        if (pixel != PaletteIndex::transparent)
+            *dst = pixel;
+    }
+}
+
+static auto GetCopyRLERunFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE copy function");
+        return CopyRLERunAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE copy function");
+        return CopyRLERunSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE copy function");
+        return CopyRLERunScalar;
+    }
+}
+
+static auto GetRemapRLERunFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE remap function");
+        return RemapRLERunAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE remap function");
+        return RemapRLERunSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE remap function");
+        return RemapRLERunScalar;
+    }
+}
+
+static auto GetGlassRLERunFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE glass function");
+        return GlassRLERunAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE glass function");
+        return GlassRLERunSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE glass function");
+        return GlassRLERunScalar;
+    }
+}
+
+static const auto CopyRLERunFunc = GetCopyRLERunFunction();
+static const auto RemapRLERunFunc = GetRemapRLERunFunction();
+static const auto GlassRLERunFunc = GetGlassRLERunFunction();
+
 template<DrawBlendOp TBlendOp>
 static void FASTCALL DrawRLESpriteMagnify(RenderTarget& rt, const DrawSpriteArgs& args)
 {
@@ -29,33 +153,34 @@ static void FASTCALL DrawRLESpriteMagnify(RenderTarget& rt, const DrawSpriteArgs
 
     for (int32_t y = 0; y < height; y++)
     {
-        PaletteIndex* nextDst = dst + dstLineWidth;
         const int32_t rowNum = zoom.ApplyTo(srcY + y);
         uint16_t lineOffset;
         std::memcpy(&lineOffset, &imgData[rowNum * sizeof(uint16_t)], sizeof(uint16_t));
         const uint8_t* data8 = imgData + lineOffset;
 
+        // Walk the runs instead of looking up the run of every destination pixel. The run kernels can not be used here
+        // as they skip source pixels, while every source pixel covers several destination pixels when zoomed in.
         bool lastDataForLine = false;
-        int32_t numPixels = 0;
-        uint8_t pixelRunStart = 0;
-        for (int32_t x = 0; x < width; x++)
+        while (!lastDataForLine)
         {
-            const int32_t colNum = zoom.ApplyTo(srcX + x);
+            int32_t numPixels = *data8++;
+            const int32_t pixelRunStart = *data8++;
+            lastDataForLine = numPixels & 0x80;
+            numPixels &= 0x7F;
+            const auto* src = reinterpret_cast<const PaletteIndex*>(data8);
+            data8 += numPixels;
 
-            while (colNum >= pixelRunStart + numPixels && !lastDataForLine)
-            {
-                data8 += numPixels;
-                numPixels = *data8++;
-                pixelRunStart = *data8++;
-                lastDataForLine = numPixels & 0x80;
-                numPixels &= 0x7F;
-            }
-            if (pixelRunStart <= colNum && colNum < pixelRunStart + numPixels)
-                BlitPixel<TBlendOp>(reinterpret_cast<const PaletteIndex*>(data8 + colNum - pixelRunStart), dst, paletteMap);
-            dst++;
+            const int32_t runStartX = zoom.ApplyInversedTo(pixelRunStart) - srcX;
+            if (runStartX >= width)
+                break;
+
+            const int32_t startX = std::max(runStartX, 0);
+            const int32_t endX = std::min(zoom.ApplyInversedTo(pixelRunStart + numPixels) - srcX, width);
+            for (int32_t x = startX; x < endX; x++)
+                BlitPixel<TBlendOp>(src + zoom.ApplyTo(srcX + x) - pixelRunStart, dst + x, paletteMap);
         }
 
-        dst = nextDst;
+        dst += dstLineWidth;
     }
 }
 
@@ -141,19 +266,129 @@ static void FASTCALL DrawRLESpriteMinify(RenderTarget& rt, const DrawSpriteArgs&
             }
             else
             {
-                auto& paletteMap = args.PalMap;
-                while (numPixels > 0)
+                // Sprites drawn through here always skip transparent pixels, which the run kernels rely on.
+                static_assert((TBlendOp & kBlendTransparent) != 0);
+                const auto* runSrc = reinterpret_cast<const PaletteIndex*>(src);
+                if constexpr ((TBlendOp & kBlendSrc) != 0 && (TBlendOp & kBlendDst) != 0)
+                {
+                    BlendRLERunScalar(dst, runSrc, numPixels, TZoom, args.PalMap.GetData().data());
+                }
+                else if constexpr ((TBlendOp & kBlendSrc) != 0)
+                {
+                    // The SIMD kernels load the whole table, shorter maps only cover the colours the sprite uses.
+                    const auto paletteMap = args.PalMap.GetData();
+                    const auto remapRLERun = paletteMap.size() >= 256 ? RemapRLERunFunc : RemapRLERunScalar;
+                    remapRLERun(dst, runSrc, numPixels, TZoom, paletteMap.data());
+                }
+                else if constexpr ((TBlendOp & kBlendDst) != 0)
+                {
+                    const auto paletteMap = args.PalMap.GetData();
+                    const auto glassRLERun = paletteMap.size() >= 256 ? GlassRLERunFunc : GlassRLERunScalar;
+                    glassRLERun(dst, runSrc, numPixels, TZoom, paletteMap.data());
+                }
+                else
                 {
-                    BlitPixel<TBlendOp>(reinterpret_cast<PaletteIndex*>(src), dst, paletteMap);
-                    numPixels -= zoom;
-                    src += zoom;
-                    dst++;
+                    CopyRLERunFunc(dst, runSrc, numPixels, TZoom);
                 }
             }
         }
     }
 }
 
+/**
+ * Draws a sprite at a zoomed out level from its decimated copy, see GfxGetDecimatedSprite. Only the lines are still skipped,
+ * the runs hold exactly the pixels to draw so they are blitted without any striding.
+ * Returns false if the sprite has to be drawn from the full resolution data instead.
+ */
+template<DrawBlendOp TBlendOp, size_t TZoom>
+static bool FASTCALL DrawRLESpriteDecimated(RenderTarget& rt, const DrawSpriteArgs& args)
+{
+    static_assert(TZoom > 0);
+    static_assert((TBlendOp & kBlendTransparent) != 0);
+
+    auto srcX = args.SrcX;
+    auto srcY = args.SrcY;
+    auto width = args.Width;
+    auto height = args.Height;
+    constexpr int32_t zoom = 1 << TZoom;
+
+    // Sprites are placed on multiples of the zoom, so the sampled columns should always be the decimated ones.
+    if ((srcX & (zoom - 1)) != 0 || !args.Image.HasValue())
+        return false;
+
+    const auto decimated = GfxGetDecimatedSprite(args.Image.GetIndex(), args.SourceImage, TZoom);
+    const uint8_t* src0 = decimated->data();
+    auto dst0 = args.DestinationBits;
+    auto dstLineWidth = static_cast<size_t>(rt.LineStride());
+
+    // See DrawRLESpriteMinify
+    if (srcY < 0)
+    {
+        srcY += zoom;
+        height -= zoom;
+        dst0 += dstLineWidth;
+    }
+
+    // Columns in the decimated sprite are already scaled down.
+    srcX >>= TZoom;
+    width = (width + zoom - 1) >> TZoom;
+
+    for (int32_t i = 0; i < height; i += zoom)
+    {
+        int32_t y = srcY + i;
+        uint16_t lineOffset;
+        std::memcpy(&lineOffset, &src0[y * sizeof(uint16_t)], sizeof(uint16_t));
+        auto nextRun = src0 + lineOffset;
+        auto* dstLineStart = dst0 + dstLineWidth * (i >> TZoom);
+
+        auto isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            auto src = nextRun;
+            auto dataSize = *src++;
+            auto firstPixelX = *src++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            nextRun = src + dataSize;
+
+            int32_t x = firstPixelX - srcX;
+            int32_t numPixels = dataSize;
+            if (x < 0)
+            {
+                src += -x;
+                numPixels += x;
+                x = 0;
+            }
+            numPixels = std::min(numPixels, width - x);
+
+            auto* dst = dstLineStart + x;
+            const auto* runSrc = reinterpret_cast<const PaletteIndex*>(src);
+            if constexpr ((TBlendOp & kBlendSrc) != 0 && (TBlendOp & kBlendDst) != 0)
+            {
+                BlendRLERunScalar(dst, runSrc, numPixels, 0, args.PalMap.GetData().data());
+            }
+            else if constexpr ((TBlendOp & kBlendSrc) != 0)
+            {
+                const auto paletteMap = args.PalMap.GetData();
+                const auto remapRLERun = paletteMap.size() >= 256 ? RemapRLERunFunc : RemapRLERunScalar;
+                remapRLERun(dst, runSrc, numPixels, 0, paletteMap.data());
+            }
+            else if constexpr ((TBlendOp & kBlendDst) != 0)
+            {
+                const auto paletteMap = args.PalMap.GetData();
+                const auto glassRLERun = paletteMap.size() >= 256 ? GlassRLERunFunc : GlassRLERunScalar;
+                glassRLERun(dst, runSrc, numPixels, 0, paletteMap.data());
+            }
+            else
+            {
+                // Unlike the full resolution zoom 0 path, transparent pixels inside a run must not be copied.
+                CopyRLERunFunc(dst, runSrc, numPixels, 0);
+            }
+        }
+    }
+    return true;
+}
+
 template<DrawBlendOp TBlendOp>
 static void FASTCALL DrawRLESprite(RenderTarget& rt, const DrawSpriteArgs& args)
 {
@@ -168,13 +403,16 @@ static void FASTCALL DrawRLESprite(RenderTarget& rt, const DrawSpriteArgs& args)
             DrawRLESpriteMinify<TBlendOp, 0>(rt, args);
             break;
         case 1:
-            DrawRLESpriteMinify<TBlendOp, 1>(rt, args);
+            if (!DrawRLESpriteDecimated<TBlendOp, 1>(rt, args))
+                DrawRLESpriteMinify<TBlendOp, 1>(rt, args);
             break;
         case 2:
-            DrawRLESpriteMinify<TBlendOp, 2>(rt, args);
+            if (!DrawRLESpriteDecimated<TBlendOp, 2>(rt, args))
+                DrawRLESpriteMinify<TBlendOp, 2>(rt, args);
             break;
         case 3:
-            DrawRLESpriteMinify<TBlendOp, 3>(rt, args);
+            if (!DrawRLESpriteDecimated<TBlendOp, 3>(rt, args))
+                DrawRLESpriteMinify<TBlendOp, 3>(rt, args);
             break;
         default:
             assert(false);
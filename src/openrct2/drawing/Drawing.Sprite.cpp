@@ -23,8 +23,10 @@
 #include "../rct1/Csg.h"
 #include "../ui/UiContext.h"
 #include "Drawing.h"
+#include "Image.h"
 #include "ScrollingText.h"
 
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <stdexcept>
@@ -453,6 +455,8 @@ static bool _csgLoaded = false;
 
 static G1Element _g1Temp[kTempSpriteCount] = {};
 static std::vector<G1Element> _imageListElements;
+// Draw count of the last lookup of each image list element, so deferred images are dropped least recently used first.
+static std::vector<uint32_t> _imageListLastUse;
 
 /**
  *
@@ -514,6 +518,8 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
+    GfxClearDecimatedSprites();
+
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -521,6 +527,8 @@ void GfxUnloadG1()
 
 void GfxUnloadG2PalettesFontsTracks()
 {
+    GfxClearDecimatedSprites();
+
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -540,6 +548,8 @@ void GfxUnloadG2PalettesFontsTracks()
 
 void GfxUnloadCsg()
 {
+    GfxClearDecimatedSprites();
+
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -1128,7 +1138,20 @@ const G1Element* GfxGetG1Element(ImageIndex image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
-            return &_imageListElements[idx];
+            // Only written once per frame, so the painting threads do not keep writing to the same cache lines.
+            auto lastUse = std::atomic_ref(_imageListLastUse[idx]);
+            if (lastUse.load(std::memory_order_relaxed) != gCurrentDrawCount)
+            {
+                lastUse.store(gCurrentDrawCount, std::memory_order_relaxed);
+            }
+
+            // Images registered without their data are loaded on first use.
+            auto& element = _imageListElements[idx];
+            if (std::atomic_ref(element.offset).load(std::memory_order_acquire) == nullptr && element.width != 0)
+            {
+                return GfxLoadDeferredImage(static_cast<ImageIndex>(offset), element);
+            }
+            return &element;
         }
     }
     return nullptr;
@@ -1157,6 +1180,7 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
 
     if (g1 != nullptr)
     {
+        GfxInvalidateDecimatedSprite(imageId);
         if (isTemp)
         {
             _g1Temp[imageId - SPR_TEMP_BEGIN] = *g1;
@@ -1185,6 +1209,7 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
                 while (idx >= _imageListElements.size())
                 {
                     _imageListElements.resize(std::max<size_t>(256, _imageListElements.size() * 2));
+                    _imageListLastUse.resize(_imageListElements.size());
                 }
                 _imageListElements[idx] = *g1;
             }
@@ -1192,6 +1217,12 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
     }
 }
 
+uint32_t GfxGetImageListLastUse(ImageIndex imageId)
+{
+    const size_t idx = static_cast<size_t>(imageId) - SPR_IMAGE_LIST_BEGIN;
+    return idx < _imageListLastUse.size() ? _imageListLastUse[idx] : 0;
+}
+
 bool IsCsgLoaded()
 {
     return _csgLoaded;
@@ -17,6 +17,7 @@
 #include "RenderTarget.h"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -162,9 +163,16 @@ const OpenRCT2::G1Element* GfxGetG1Element(ImageId imageId);
 const OpenRCT2::G1Element* GfxGetG1Element(ImageIndex image_id);
 const OpenRCT2::G1Palette* GfxGetG1Palette(ImageIndex imageId);
 void GfxSetG1Element(ImageIndex imageId, const OpenRCT2::G1Element* g1);
+uint32_t GfxGetImageListLastUse(ImageIndex imageId);
 std::optional<OpenRCT2::Gx> GfxLoadGx(const std::vector<uint8_t>& buffer);
 bool IsCsgLoaded();
 
+// RLE sprites with only the columns sampled at zoom level 1 << zoomShift, built on first use and kept in a bounded LRU cache
+void GfxInvalidateDecimatedSprite(ImageIndex imageId);
+void GfxClearDecimatedSprites();
+std::shared_ptr<const std::vector<uint8_t>> GfxGetDecimatedSprite(
+    ImageIndex imageId, const OpenRCT2::G1Element& g1, int32_t zoomShift);
+
 // sprite blitting
 void FASTCALL GfxSpriteToBuffer(OpenRCT2::Drawing::RenderTarget& rt, const DrawSpriteArgs& args);
 void FASTCALL GfxBmpSpriteToBuffer(OpenRCT2::Drawing::RenderTarget& rt, const DrawSpriteArgs& args);
@@ -182,3 +190,42 @@ size_t G1CalculateDataSize(const OpenRCT2::G1Element* g1);
 void MaskScalar(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc,
     OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
+
+// RLE run kernels used by GfxRleSpriteToBuffer. Each writes one destination pixel for every (1 << zoomShift) pixels of
+// the source run and leaves the destination untouched where the source or the resulting pixel is transparent.
+// Copy writes the source pixel, remap writes paletteMap[source] and glass writes paletteMap[destination].
+// The SIMD variants must produce output identical to the scalar ones.
+void CopyRLERunScalar(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift);
+void CopyRLERunSse4_1(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift);
+void CopyRLERunAvx2(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift);
+
+void RemapRLERunScalar(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void RemapRLERunSse4_1(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void RemapRLERunAvx2(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+
+void GlassRLERunScalar(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void GlassRLERunSse4_1(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void GlassRLERunAvx2(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+
+// Blending looks up a table indexed by both the source and destination pixel, so it only has a scalar kernel.
+void BlendRLERunScalar(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, const OpenRCT2::Drawing::PaletteIndex* RESTRICT src, int32_t numPixels,
+    int32_t zoomShift, const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
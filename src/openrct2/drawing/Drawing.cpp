@@ -503,6 +503,46 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+void RemapRectScalar(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        for (int32_t xx = 0; xx < width; xx++)
+        {
+            dst[xx] = paletteMap[EnumValue(dst[xx])];
+        }
+        dst += width + dstWrap;
+    }
+}
+
+static auto GetRemapRectFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 rectangle remap function");
+        return RemapRectAvx2;
+    }
+    else if (Platform::SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 rectangle remap function");
+        return RemapRectSse4_1;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar rectangle remap function");
+        return RemapRectScalar;
+    }
+}
+
+static const auto RemapRectFunc = GetRemapRectFunction();
+
+void RemapRectFn(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    RemapRectFunc(dst, width, height, dstWrap, paletteMap);
+}
+
 void GfxFilterPixel(RenderTarget& rt, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     Rectangle::filter(rt, { coords, coords }, palette);
@@ -113,6 +113,23 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc,
     OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Replaces every pixel of a width by height block with paletteMap[pixel], skipping dstWrap pixels after each line.
+// Used for filtered rectangles such as the weather gloom and translucent window backgrounds.
+// The SIMD variants must produce output identical to the scalar one.
+void RemapRectScalar(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap,
+    const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void RemapRectSse4_1(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap,
+    const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+void RemapRectAvx2(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap,
+    const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+
+void RemapRectFn(
+    OpenRCT2::Drawing::PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap,
+    const OpenRCT2::Drawing::PaletteIndex* RESTRICT paletteMap);
+
 std::optional<uint32_t> GetPaletteG1Index(OpenRCT2::Drawing::FilterPaletteID paletteId);
 std::optional<OpenRCT2::Drawing::PaletteMap> GetPaletteMapForColour(OpenRCT2::Drawing::FilterPaletteID paletteId);
 void UpdatePalette(
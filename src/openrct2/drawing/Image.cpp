@@ -17,17 +17,46 @@
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
 
 constexpr uint32_t kBaseImageID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t kMaxImages = SPR_IMAGE_LIST_END - kBaseImageID;
 
+// Decoded data of deferred images is dropped between frames, least recently used first, once it exceeds this.
+constexpr size_t kDeferredImageBudget = 64 * 1024 * 1024;
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+namespace
+{
+    struct DeferredImage
+    {
+        std::shared_ptr<const IDeferredImageSource> source;
+        uint32_t index{};
+        // The element as it was registered, without any data.
+        G1Element element{};
+        std::vector<uint8_t> data;
+        std::list<ImageIndex>::iterator loadedIt{};
+        bool failed{};
+    };
+
+    std::mutex _deferredImagesMutex;
+    std::unordered_map<ImageIndex, DeferredImage> _deferredImages;
+    // Deferred images which currently have data, ordered by their last use when trimming.
+    std::list<ImageIndex> _loadedDeferredImages;
+    std::unordered_set<std::shared_ptr<const IDeferredImageSource>> _usedDeferredImageSources;
+    size_t _deferredImagesMemoryUsage;
+} // namespace
+
 #ifdef DEBUG_LEVEL_1
 static std::list<ImageList> _allocatedLists;
 
@@ -188,7 +217,35 @@ static void FreeImageList(uint32_t baseImageId, uint32_t count)
     _freeLists.push_back({ baseImageId, count });
 }
 
-uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
+static void UnloadDeferredImage(DeferredImage& deferred)
+{
+    if (!deferred.data.empty())
+    {
+        _deferredImagesMemoryUsage -= deferred.data.size();
+        _loadedDeferredImages.erase(deferred.loadedIt);
+        deferred.data = {};
+    }
+}
+
+static void UnregisterDeferredImages(uint32_t baseImageId, uint32_t count)
+{
+    std::lock_guard lock(_deferredImagesMutex);
+    if (_deferredImages.empty())
+        return;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto it = _deferredImages.find(baseImageId + i);
+        if (it != _deferredImages.end())
+        {
+            UnloadDeferredImage(it->second);
+            _deferredImages.erase(it);
+        }
+    }
+}
+
+uint32_t GfxObjectAllocateImages(
+    const G1Element* images, uint32_t count, std::shared_ptr<const IDeferredImageSource> deferredImages)
 {
     if (count == 0 || gOpenRCT2NoGraphics)
     {
@@ -207,6 +264,14 @@ uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
     {
         GfxSetG1Element(imageId, &images[i]);
         DrawingEngineInvalidateImage(imageId);
+        if (deferredImages != nullptr && deferredImages->IsDeferred(i))
+        {
+            std::lock_guard lock(_deferredImagesMutex);
+            auto& deferred = _deferredImages[imageId];
+            deferred.source = deferredImages;
+            deferred.index = i;
+            deferred.element = images[i];
+        }
         imageId++;
     }
 
@@ -226,6 +291,7 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
             GfxSetG1Element(imageId, &g1);
             DrawingEngineInvalidateImage(imageId);
         }
+        UnregisterDeferredImages(baseImageId, count);
 
         FreeImageList(baseImageId, count);
     }
@@ -257,3 +323,76 @@ const std::list<ImageList>& GetAvailableAllocationRanges()
 {
     return _freeLists;
 }
+
+/**
+ * Loads the data of a deferred image on its first lookup, element being the entry for it in the image list. Images
+ * which could not be decoded are treated like missing ones.
+ */
+const G1Element* GfxLoadDeferredImage(ImageIndex imageId, G1Element& element)
+{
+    std::shared_ptr<const IDeferredImageSource> source;
+    uint32_t index;
+    {
+        std::lock_guard lock(_deferredImagesMutex);
+        auto it = _deferredImages.find(imageId);
+        if (it == _deferredImages.end() || !it->second.data.empty())
+            return &element;
+        if (it->second.failed)
+            return nullptr;
+
+        source = it->second.source;
+        index = it->second.index;
+        _usedDeferredImageSources.insert(source);
+    }
+
+    // Decode outside of the lock so other threads can carry on drawing, if another thread got there first its copy is
+    // simply discarded.
+    auto data = source->LoadImage(index);
+
+    std::lock_guard lock(_deferredImagesMutex);
+    auto it = _deferredImages.find(imageId);
+    if (it == _deferredImages.end() || !it->second.data.empty())
+        return &element;
+
+    auto& deferred = it->second;
+    if (data.empty())
+    {
+        deferred.failed = true;
+        return nullptr;
+    }
+
+    deferred.data = std::move(data);
+    deferred.loadedIt = _loadedDeferredImages.insert(_loadedDeferredImages.end(), imageId);
+    _deferredImagesMemoryUsage += deferred.data.size();
+    std::atomic_ref(element.offset).store(deferred.data.data(), std::memory_order_release);
+    return &element;
+}
+
+/**
+ * Must be called between frames, while no thread is drawing, as images are unloaded again once their data exceeds the
+ * budget.
+ */
+void GfxTrimDeferredImages()
+{
+    std::lock_guard lock(_deferredImagesMutex);
+    for (const auto& source : _usedDeferredImageSources)
+    {
+        source->ReleaseCaches();
+    }
+    _usedDeferredImageSources.clear();
+
+    if (_deferredImagesMemoryUsage <= kDeferredImageBudget)
+        return;
+
+    // Lookups of loaded images do not come through here, so the order is taken from the last use of their elements.
+    // The sort is stable, images last used in the same frame are dropped in the order they were loaded.
+    _loadedDeferredImages.sort(
+        [](ImageIndex a, ImageIndex b) { return GfxGetImageListLastUse(a) < GfxGetImageListLastUse(b); });
+    while (_deferredImagesMemoryUsage > kDeferredImageBudget)
+    {
+        const auto imageId = _loadedDeferredImages.front();
+        auto& deferred = _deferredImages[imageId];
+        GfxSetG1Element(imageId, &deferred.element);
+        UnloadDeferredImage(deferred);
+    }
+}
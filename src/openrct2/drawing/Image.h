@@ -14,12 +14,34 @@
 #include <cstddef>
 #include <cstdint>
 #include <list>
+#include <memory>
+#include <vector>
 
 namespace OpenRCT2
 {
     struct G1Element;
 }
 
+namespace OpenRCT2::Drawing
+{
+    /**
+     * Decodes the images of an image list which are registered before their data has been loaded. The data is only
+     * requested when an image is first looked up, which may happen from any of the painting threads.
+     */
+    struct IDeferredImageSource
+    {
+        virtual ~IDeferredImageSource() = default;
+
+        [[nodiscard]] virtual bool IsDeferred(uint32_t index) const = 0;
+
+        // Returns the data for the image at the given index of the list, or nothing if it can not be decoded.
+        [[nodiscard]] virtual std::vector<uint8_t> LoadImage(uint32_t index) const = 0;
+
+        // Called between frames to drop anything kept around for decoding several images in a row.
+        virtual void ReleaseCaches() const = 0;
+    };
+} // namespace OpenRCT2::Drawing
+
 struct ImageList
 {
     ImageIndex BaseId{};
@@ -58,9 +80,13 @@ constexpr bool operator!=(const ImageList& lhs, const ImageList& rhs)
     return !(lhs == rhs);
 }
 
-uint32_t GfxObjectAllocateImages(const OpenRCT2::G1Element* images, uint32_t count);
+uint32_t GfxObjectAllocateImages(
+    const OpenRCT2::G1Element* images, uint32_t count,
+    std::shared_ptr<const OpenRCT2::Drawing::IDeferredImageSource> deferredImages = nullptr);
 void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count);
 void GfxObjectCheckAllImagesFreed();
 size_t ImageListGetUsedCount();
 size_t ImageListGetMaximum();
 const std::list<ImageList>& GetAvailableAllocationRanges();
+const OpenRCT2::G1Element* GfxLoadDeferredImage(ImageIndex imageId, OpenRCT2::G1Element& element);
+void GfxTrimDeferredImages();
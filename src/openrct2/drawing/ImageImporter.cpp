@@ -13,14 +13,153 @@
 #include "../core/Imaging.h"
 #include "../core/Json.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace OpenRCT2::Drawing
 {
     static constexpr int32_t kPaletteTransparent = -1;
 
+    /**
+     * Splits the colour cube into cells, each of which lists the only palette entries that can match a colour inside of
+     * it. Both searches return the same entry as a search through the whole palette would.
+     */
+    class ImageImporter::PaletteLookup
+    {
+    private:
+        static constexpr int32_t kCellShift = 4;
+        static constexpr int32_t kCellSize = 1 << kCellShift;
+        static constexpr int32_t kCellsPerAxis = 256 / kCellSize;
+        static constexpr int32_t kNumCells = kCellsPerAxis * kCellsPerAxis * kCellsPerAxis;
+
+        const GamePalette& _palette;
+        // The entries which colours can be matched to if there is no exact match, in palette order.
+        std::vector<uint8_t> _changeable;
+        // The entries lying inside of each cell, in palette order.
+        std::array<std::vector<uint8_t>, kNumCells> _exactCandidates;
+        // The changeable entries which are the closest to at least one colour inside of each cell, in palette order.
+        std::array<std::vector<uint8_t>, kNumCells> _closestCandidates;
+
+    public:
+        explicit PaletteLookup(const GamePalette& palette)
+            : _palette(palette)
+        {
+            for (int32_t i = 0; i < static_cast<int32_t>(kGamePaletteSize); i++)
+            {
+                _exactCandidates[GetCell(palette[i].red, palette[i].green, palette[i].blue)].push_back(static_cast<uint8_t>(i));
+                if (IsChangablePixel(i))
+                    _changeable.push_back(static_cast<uint8_t>(i));
+            }
+
+            for (int32_t r = 0; r < kCellsPerAxis; r++)
+            {
+                for (int32_t g = 0; g < kCellsPerAxis; g++)
+                {
+                    for (int32_t b = 0; b < kCellsPerAxis; b++)
+                    {
+                        const std::array<int32_t, 3> lo = { r * kCellSize, g * kCellSize, b * kCellSize };
+
+                        // The closest entry to any colour inside of the cell is at most as far away from it as the
+                        // furthest corner of the cell is from the entry nearest to that corner, so every entry which
+                        // is further away from the whole cell can be skipped.
+                        auto maxError = std::numeric_limits<int32_t>::max();
+                        for (auto index : _changeable)
+                        {
+                            maxError = std::min(maxError, GetCellDistance(lo, index, true));
+                        }
+
+                        auto& candidates = _closestCandidates[GetCell(lo[0], lo[1], lo[2])];
+                        for (auto index : _changeable)
+                        {
+                            if (GetCellDistance(lo, index, false) <= maxError)
+                                candidates.push_back(index);
+                        }
+                    }
+                }
+            }
+        }
+
+        int32_t FindExact(const int16_t* colour) const
+        {
+            if (!IsInRange(colour))
+                return kPaletteTransparent;
+
+            for (auto index : _exactCandidates[GetCell(colour[0], colour[1], colour[2])])
+            {
+                if (_palette[index].red == colour[0] && _palette[index].green == colour[1] && _palette[index].blue == colour[2])
+                {
+                    return index;
+                }
+            }
+            return kPaletteTransparent;
+        }
+
+        int32_t FindClosest(const int16_t* colour) const
+        {
+            // Dithering can push colours outside of the cube, those are compared against every entry.
+            const auto& candidates = IsInRange(colour) ? _closestCandidates[GetCell(colour[0], colour[1], colour[2])]
+                                                       : _changeable;
+
+            auto smallestError = static_cast<uint32_t>(-1);
+            auto bestMatch = kPaletteTransparent;
+            for (auto index : candidates)
+            {
+                const int32_t dr = static_cast<int16_t>(_palette[index].red) - colour[0];
+                const int32_t dg = static_cast<int16_t>(_palette[index].green) - colour[1];
+                const int32_t db = static_cast<int16_t>(_palette[index].blue) - colour[2];
+                const auto error = static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+                if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
+                {
+                    bestMatch = index;
+                    smallestError = error;
+                }
+            }
+            return bestMatch;
+        }
+
+    private:
+        static bool IsInRange(const int16_t* colour)
+        {
+            return colour[0] >= 0 && colour[0] <= 255 && colour[1] >= 0 && colour[1] <= 255 && colour[2] >= 0
+                && colour[2] <= 255;
+        }
+
+        static int32_t GetCell(int32_t r, int32_t g, int32_t b)
+        {
+            return ((r >> kCellShift) * kCellsPerAxis + (g >> kCellShift)) * kCellsPerAxis + (b >> kCellShift);
+        }
+
+        // Squared distance from a palette entry to the nearest or furthest colour inside of the cell starting at lo.
+        int32_t GetCellDistance(const std::array<int32_t, 3>& lo, uint8_t index, bool furthest) const
+        {
+            const std::array<int32_t, 3> entry = { _palette[index].red, _palette[index].green, _palette[index].blue };
+            int32_t distance = 0;
+            for (size_t i = 0; i < entry.size(); i++)
+            {
+                const int32_t hi = lo[i] + kCellSize - 1;
+                int32_t delta;
+                if (furthest)
+                    delta = std::max(std::abs(entry[i] - lo[i]), std::abs(entry[i] - hi));
+                else
+                    delta = entry[i] < lo[i] ? lo[i] - entry[i] : (entry[i] > hi ? entry[i] - hi : 0);
+                distance += delta * delta;
+            }
+            return distance;
+        }
+    };
+
+    const ImageImporter::PaletteLookup& ImageImporter::GetPaletteLookup()
+    {
+        static const PaletteLookup lookup(StandardPalette);
+        return lookup;
+    }
+
     ImageImportResult ImageImporter::Import(const Image& image, ImageImportMeta& meta) const
     {
         if (meta.srcSize.width == 0)
@@ -43,6 +182,17 @@ namespace OpenRCT2::Drawing
         auto pixels = GetPixels(image, meta);
         auto buffer = isRLE ? EncodeRLE(pixels.data(), meta.srcSize) : EncodeRaw(pixels.data(), meta.srcSize);
 
+        ImageImportResult result;
+        result.Element = CreateElement(meta);
+        result.Buffer = std::move(buffer);
+        result.Element.offset = result.Buffer.data();
+        return result;
+    }
+
+    G1Element ImageImporter::CreateElement(const ImageImportMeta& meta)
+    {
+        const bool isRLE = meta.importFlags.has(ImportFlag::rle);
+
         G1Element outElement;
         outElement.width = meta.srcSize.width;
         outElement.height = meta.srcSize.height;
@@ -52,12 +202,7 @@ namespace OpenRCT2::Drawing
         outElement.zoomedOffset = meta.zoomedOffset;
         if (meta.importFlags.has(ImportFlag::noDrawOnZoom))
             outElement.flags.set(G1Flag::noZoomDraw);
-
-        ImageImportResult result;
-        result.Element = outElement;
-        result.Buffer = std::move(buffer);
-        result.Element.offset = result.Buffer.data();
-        return result;
+        return outElement;
     }
 
     PaletteImportResult ImageImporter::importJSONPalette(json_t& jPalette) const
@@ -284,10 +429,10 @@ namespace OpenRCT2::Drawing
         ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
     {
         auto& palette = StandardPalette;
-        auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
-        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(palette, rgbaSrc))
+        auto paletteIndex = GetPaletteIndex(rgbaSrc);
+        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = GetClosestPaletteIndex(rgbaSrc);
             if (mode == ImportMode::Dithering)
             {
                 auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].red);
@@ -299,8 +444,8 @@ namespace OpenRCT2::Drawing
 
                 if (x + 1 < width)
                 {
-                    if (!IsInPalette(palette, rgbaSrc + 4)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4)))
+                    if (!IsInPalette(rgbaSrc + 4)
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(rgbaSrc + 4)))
                     {
                         // Right
                         rgbaSrc[4] += dr * 7 / 16;
@@ -313,8 +458,8 @@ namespace OpenRCT2::Drawing
                 {
                     if (x > 0)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width - 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        if (!IsInPalette(rgbaSrc + 4 * (width - 1))
+                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(rgbaSrc + 4 * (width - 1))))
                         {
                             // Bottom left
                             rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -324,8 +469,8 @@ namespace OpenRCT2::Drawing
                     }
 
                     // Bottom
-                    if (!IsInPalette(palette, rgbaSrc + 4 * width)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * width)))
+                    if (!IsInPalette(rgbaSrc + 4 * width)
+                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(rgbaSrc + 4 * width)))
                     {
                         rgbaSrc[4 * width] += dr * 5 / 16;
                         rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -334,8 +479,8 @@ namespace OpenRCT2::Drawing
 
                     if (x + 1 < width)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width + 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        if (!IsInPalette(rgbaSrc + 4 * (width + 1))
+                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(rgbaSrc + 4 * (width + 1))))
                         {
                             // Bottom right
                             rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -350,18 +495,11 @@ namespace OpenRCT2::Drawing
         return paletteIndex;
     }
 
-    int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+    int32_t ImageImporter::GetPaletteIndex(const int16_t* colour)
     {
         if (!IsTransparentPixel(colour))
         {
-            for (uint32_t i = 0; i < kGamePaletteSize; i++)
-            {
-                if (static_cast<int16_t>(palette[i].red) == colour[0] && static_cast<int16_t>(palette[i].green) == colour[1]
-                    && static_cast<int16_t>(palette[i].blue) == colour[2])
-                {
-                    return i;
-                }
-            }
+            return GetPaletteLookup().FindExact(colour);
         }
         return kPaletteTransparent;
     }
@@ -374,9 +512,9 @@ namespace OpenRCT2::Drawing
     /**
      * @returns true if this colour is in the standard palette.
      */
-    bool ImageImporter::IsInPalette(const GamePalette& palette, int16_t* colour)
+    bool ImageImporter::IsInPalette(const int16_t* colour)
     {
-        return !(GetPaletteIndex(palette, colour) == kPaletteTransparent && !IsTransparentPixel(colour));
+        return !(GetPaletteIndex(colour) == kPaletteTransparent && !IsTransparentPixel(colour));
     }
 
     /**
@@ -408,28 +546,9 @@ namespace OpenRCT2::Drawing
         return PaletteIndexType::Normal;
     }
 
-    int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+    int32_t ImageImporter::GetClosestPaletteIndex(const int16_t* colour)
     {
-        auto smallestError = static_cast<uint32_t>(-1);
-        auto bestMatch = kPaletteTransparent;
-        for (uint32_t x = 0; x < kGamePaletteSize; x++)
-        {
-            if (IsChangablePixel(x))
-            {
-                uint32_t error = (static_cast<int16_t>(palette[x].red) - colour[0])
-                        * (static_cast<int16_t>(palette[x].red) - colour[0])
-                    + (static_cast<int16_t>(palette[x].green) - colour[1])
-                        * (static_cast<int16_t>(palette[x].green) - colour[1])
-                    + (static_cast<int16_t>(palette[x].blue) - colour[2]) * (static_cast<int16_t>(palette[x].blue) - colour[2]);
-
-                if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
-                {
-                    bestMatch = x;
-                    smallestError = error;
-                }
-            }
-        }
-        return bestMatch;
+        return GetPaletteLookup().FindClosest(colour);
     }
 
     ImageImportMeta createImageImportMetaFromJson(json_t& input)
@@ -68,6 +68,10 @@ namespace OpenRCT2::Drawing
     {
     public:
         ImageImportResult Import(const Image& image, ImageImportMeta& meta) const;
+        /**
+         * Returns the element Import will create for the given meta, without any data. The source size must be set.
+         */
+        static G1Element CreateElement(const ImageImportMeta& meta);
         PaletteImportResult importJSONPalette(json_t& jPalette) const;
 
     private:
@@ -86,12 +90,18 @@ namespace OpenRCT2::Drawing
 
         static int32_t CalculatePaletteIndex(
             ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height);
-        static int32_t GetPaletteIndex(const GamePalette& palette, int16_t* colour);
+        /**
+         * Finds the entries of the standard palette for a colour, see ImageImporter.cpp.
+         */
+        class PaletteLookup;
+        static const PaletteLookup& GetPaletteLookup();
+
+        static int32_t GetPaletteIndex(const int16_t* colour);
         static bool IsTransparentPixel(const int16_t* colour);
-        static bool IsInPalette(const GamePalette& palette, int16_t* colour);
+        static bool IsInPalette(const int16_t* colour);
         static bool IsChangablePixel(int32_t paletteIndex);
         static PaletteIndexType GetPaletteIndexType(int32_t paletteIndex);
-        static int32_t GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour);
+        static int32_t GetClosestPaletteIndex(const int16_t* colour);
         BGRColour parseJSONPaletteColour(const std::string& s) const;
     };
 
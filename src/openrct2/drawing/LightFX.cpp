@@ -13,11 +13,14 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../config/Config.h"
+#include "../core/EnumUtils.hpp"
+#include "../core/JobPool.h"
 #include "../entity/EntityRegistry.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../interface/WindowBase.h"
 #include "../paint/Paint.h"
+#include "../platform/Platform.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
@@ -27,6 +30,8 @@
 
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 namespace OpenRCT2::Drawing::LightFx
 {
@@ -86,6 +91,118 @@ namespace OpenRCT2::Drawing::LightFx
 
     static GamePalette gPalette_light;
 
+    struct LightBlit
+    {
+        const uint8_t* src;
+        uint32_t srcPitch;
+        int32_t x;
+        int32_t y;
+        int32_t width;
+        int32_t height;
+        uint8_t intensity;
+    };
+
+    static std::vector<LightBlit> _lightBlits;
+
+    // Number of rows blended per job when the light buffer is composited on multiple threads.
+    static constexpr uint32_t kRowsPerJob = 64;
+    static std::unique_ptr<JobPool> _renderJobs;
+
+    void AccumulateLightScalar(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity)
+    {
+        if (intensity == 0xFF)
+        {
+            for (uint32_t x = 0; x < count; x++)
+            {
+                dst[x] = std::min(0xFF, dst[x] + src[x]);
+            }
+        }
+        else
+        {
+            for (uint32_t x = 0; x < count; x++)
+            {
+                dst[x] = std::min(0xFF, dst[x] + ((src[x] * (1 + intensity)) >> 8));
+            }
+        }
+    }
+
+    static uint8_t MixLight(uint32_t a, uint32_t b, uint32_t intensity)
+    {
+        intensity = intensity * 6;
+        uint32_t bMul = (b * intensity) >> 8;
+        uint32_t ab = a + bMul;
+        uint8_t result = static_cast<uint8_t>(std::min<uint32_t>(255, ab));
+        return result;
+    }
+
+    void MixLightRowScalar(
+        uint32_t* RESTRICT dst, const PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette)
+    {
+        for (uint32_t x = 0; x < count; x++)
+        {
+            PaletteIndex src = bits[x];
+            uint32_t darkColour = palette[EnumValue(src)];
+            uint32_t lightColour = lightPalette[EnumValue(src)];
+            uint8_t lightIntensity = lightBits[x];
+
+            uint32_t colour = 0;
+            if (lightIntensity == 0)
+            {
+                colour = darkColour;
+            }
+            else
+            {
+                colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+                colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+                colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+                colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+            }
+            dst[x] = colour;
+        }
+    }
+
+    static auto GetAccumulateLightFunction()
+    {
+        if (Platform::AVX2Available())
+        {
+            LOG_VERBOSE("registering AVX2 light accumulation function");
+            return AccumulateLightAvx2;
+        }
+        else if (Platform::SSE41Available())
+        {
+            LOG_VERBOSE("registering SSE4.1 light accumulation function");
+            return AccumulateLightSse4_1;
+        }
+        else
+        {
+            LOG_VERBOSE("registering scalar light accumulation function");
+            return AccumulateLightScalar;
+        }
+    }
+
+    static auto GetMixLightRowFunction()
+    {
+        if (Platform::AVX2Available())
+        {
+            LOG_VERBOSE("registering AVX2 light mixing function");
+            return MixLightRowAvx2;
+        }
+        else if (Platform::SSE41Available())
+        {
+            LOG_VERBOSE("registering SSE4.1 light mixing function");
+            return MixLightRowSse4_1;
+        }
+        else
+        {
+            LOG_VERBOSE("registering scalar light mixing function");
+            return MixLightRowScalar;
+        }
+    }
+
+    static const auto AccumulateLightFunc = GetAccumulateLightFunction();
+    static const auto MixLightRowFunc = GetMixLightRowFunction();
+
     constexpr uint8_t GetLightTypeSize(LightType type)
     {
         return static_cast<uint8_t>(type) & 0x3;
@@ -448,14 +565,13 @@ namespace OpenRCT2::Drawing::LightFx
         _current_view_zoom_back = vp.zoom;
     }
 
-    static void RenderLightsToFrontBuffer()
+    /**
+     * Clips every light in the front list against the light buffer, the lights are accumulated afterwards in bands of
+     * rows by RenderLightsToFrontBuffer so that this can be split across threads.
+     */
+    static void PrepareLightBlits()
     {
-        if (_light_rendered_buffer_front == nullptr)
-        {
-            return;
-        }
-
-        std::memset(_light_rendered_buffer_front, 0, _pixelInfo.width * _pixelInfo.height);
+        _lightBlits.clear();
 
         _lightPolution_back = 0;
 
@@ -464,11 +580,9 @@ namespace OpenRCT2::Drawing::LightFx
         for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
         {
             const uint8_t* bufReadBase = nullptr;
-            uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
             uint32_t bufReadWidth, bufReadHeight;
             int32_t bufWriteX, bufWriteY;
             int32_t bufWriteWidth, bufWriteHeight;
-            uint32_t bufReadSkip, bufWriteSkip;
 
             LightListEntry& entry = _LightListFront[light];
 
@@ -544,10 +658,6 @@ namespace OpenRCT2::Drawing::LightFx
                 bufReadBase += -bufWriteX;
                 bufWriteWidth += bufWriteX;
             }
-            else
-            {
-                bufWriteBase += bufWriteX;
-            }
 
             if (bufWriteWidth <= 0)
                 continue;
@@ -557,10 +667,6 @@ namespace OpenRCT2::Drawing::LightFx
                 bufReadBase += -bufWriteY * bufReadWidth;
                 bufWriteHeight += bufWriteY;
             }
-            else
-            {
-                bufWriteBase += bufWriteY * _pixelInfo.width;
-            }
 
             if (bufWriteHeight <= 0)
                 continue;
@@ -584,38 +690,31 @@ namespace OpenRCT2::Drawing::LightFx
 
             _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
 
-            bufReadSkip = bufReadWidth - bufWriteWidth;
-            bufWriteSkip = _pixelInfo.width - bufWriteWidth;
+            _lightBlits.push_back(
+                { bufReadBase, bufReadWidth, std::max(bufWriteX, 0), std::max(bufWriteY, 0), bufWriteWidth, bufWriteHeight,
+                  entry.lightIntensity });
+        }
+    }
 
-            if (entry.lightIntensity == 0xFF)
-            {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
-                {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
-                    {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                        bufWriteBase++;
-                        bufReadBase++;
-                    }
+    /**
+     * Clears and accumulates all prepared lights into the rows [startY, endY) of the front light buffer.
+     */
+    static void RenderLightsToFrontBuffer(int32_t startY, int32_t endY)
+    {
+        auto* lightBuffer = static_cast<uint8_t*>(_light_rendered_buffer_front);
+        const int32_t lightBufferWidth = _pixelInfo.width;
 
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
-                }
-            }
-            else
-            {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
-                {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
-                    {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry.lightIntensity)) >> 8));
-                        bufWriteBase++;
-                        bufReadBase++;
-                    }
+        std::memset(lightBuffer + startY * lightBufferWidth, 0, (endY - startY) * lightBufferWidth);
 
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
-                }
+        for (const auto& blit : _lightBlits)
+        {
+            const int32_t blitStartY = std::max(startY, blit.y);
+            const int32_t blitEndY = std::min(endY, blit.y + blit.height);
+            for (int32_t y = blitStartY; y < blitEndY; y++)
+            {
+                uint8_t* dst = lightBuffer + y * lightBufferWidth + blit.x;
+                const uint8_t* src = blit.src + (y - blit.y) * blit.srcPitch;
+                AccumulateLightFunc(dst, src, blit.width, blit.intensity);
             }
         }
     }
@@ -1015,15 +1114,6 @@ namespace OpenRCT2::Drawing::LightFx
         }
     }
 
-    static uint8_t MixLight(uint32_t a, uint32_t b, uint32_t intensity)
-    {
-        intensity = intensity * 6;
-        uint32_t bMul = (b * intensity) >> 8;
-        uint32_t ab = a + bMul;
-        uint8_t result = static_cast<uint8_t>(std::min<uint32_t>(255, ab));
-        return result;
-    }
-
     void RenderToTexture(
         const Viewport& vp, void* dstPixels, uint32_t dstPitch, PaletteIndex* bits, uint32_t width, uint32_t height,
         const uint32_t* palette, const uint32_t* lightPalette)
@@ -1031,7 +1121,6 @@ namespace OpenRCT2::Drawing::LightFx
         UpdateViewportSettings(vp);
         SwapBuffers();
         PrepareLightList(vp);
-        RenderLightsToFrontBuffer();
 
         uint8_t* lightBits = static_cast<uint8_t*>(GetFrontBuffer());
         if (lightBits == nullptr)
@@ -1039,31 +1128,42 @@ namespace OpenRCT2::Drawing::LightFx
             return;
         }
 
-        for (uint32_t y = 0; y < height; y++)
-        {
-            uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
-            uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
-            for (uint32_t x = 0; x < width; x++)
+        PrepareLightBlits();
+
+        const auto lightBufferHeight = static_cast<uint32_t>(_pixelInfo.height);
+        auto renderRows = [=](uint32_t startY, uint32_t endY) {
+            RenderLightsToFrontBuffer(
+                static_cast<int32_t>(std::min(startY, lightBufferHeight)), static_cast<int32_t>(std::min(endY, lightBufferHeight)));
+
+            for (uint32_t y = startY; y < endY; y++)
             {
-                PaletteIndex src = bits[y * width + x];
-                uint32_t darkColour = palette[EnumValue(src)];
-                uint32_t lightColour = lightPalette[EnumValue(src)];
-                uint8_t lightIntensity = lightBits[y * width + x];
+                auto* dst = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(dstPixels) + static_cast<size_t>(y) * dstPitch);
+                MixLightRowFunc(dst, bits + y * width, lightBits + y * width, width, palette, lightPalette);
+            }
+        };
 
-                uint32_t colour = 0;
-                if (lightIntensity == 0)
-                {
-                    colour = darkColour;
-                }
-                else
-                {
-                    colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                    colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                    colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                    colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
-                }
-                *dst++ = colour;
+        bool useMultithreading = Config::Get().general.multiThreading;
+        if (useMultithreading && _renderJobs == nullptr)
+        {
+            _renderJobs = std::make_unique<JobPool>();
+        }
+        else if (useMultithreading == false && _renderJobs != nullptr)
+        {
+            _renderJobs.reset();
+        }
+
+        if (useMultithreading && height > kRowsPerJob)
+        {
+            for (uint32_t startY = 0; startY < height; startY += kRowsPerJob)
+            {
+                const uint32_t endY = std::min(startY + kRowsPerJob, height);
+                _renderJobs->AddTask([=]() -> void { renderRows(startY, endY); });
             }
+            _renderJobs->Join();
+        }
+        else
+        {
+            renderRows(0, height);
         }
     }
 } // namespace OpenRCT2::Drawing::LightFx
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../core/CallingConventions.h"
 #include "ColourPalette.h"
 
 #include <cstdint>
@@ -76,4 +77,19 @@ namespace OpenRCT2::Drawing::LightFx
         const Viewport& vp, void* dstPixels, uint32_t dstPitch, Drawing::PaletteIndex* bits, uint32_t width, uint32_t height,
         const uint32_t* palette, const uint32_t* lightPalette);
 
+    // Row kernels used by RenderToTexture. The SIMD variants must produce output identical to the scalar ones.
+    void AccumulateLightScalar(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity);
+    void AccumulateLightSse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity);
+    void AccumulateLightAvx2(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity);
+
+    void MixLightRowScalar(
+        uint32_t* RESTRICT dst, const Drawing::PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette);
+    void MixLightRowSse4_1(
+        uint32_t* RESTRICT dst, const Drawing::PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette);
+    void MixLightRowAvx2(
+        uint32_t* RESTRICT dst, const Drawing::PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette);
+
 } // namespace OpenRCT2::Drawing::LightFx
@@ -55,6 +55,12 @@ namespace OpenRCT2::Drawing
         PaletteIndex& operator[](size_t index);
         PaletteIndex operator[](size_t index) const;
 
+        // Raw access to the table for run kernels that remap many pixels at once.
+        std::span<const PaletteIndex> GetData() const
+        {
+            return _data;
+        }
+
         PaletteIndex Blend(PaletteIndex src, PaletteIndex dst) const;
         void Copy(PaletteIndex dstIndex, const PaletteMap& src, PaletteIndex srcIndex, size_t length);
     };
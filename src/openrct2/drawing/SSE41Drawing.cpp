@@ -9,12 +9,14 @@
 
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "LightFX.h"
 #include "PaletteIndex.h"
 
 using OpenRCT2::Drawing::PaletteIndex;
 
 #ifdef __SSE4_1__
 
+    #include <cstring>
     #include <immintrin.h>
 
 void MaskSse4_1(
@@ -58,6 +60,267 @@ void MaskSse4_1(
     }
 }
 
+// Gathers every (1 << TZoom)th pixel of the next 16 << TZoom run pixels. The wanted pixel is the low byte of each
+// element, so mask everything else off and let unsigned saturation narrow the elements down to bytes.
+template<int32_t TZoom>
+static __m128i GatherRLERunSse4_1(const PaletteIndex* src)
+{
+    const auto* p = reinterpret_cast<const __m128i*>(src);
+    if constexpr (TZoom == 0)
+    {
+        return _mm_loadu_si128(p);
+    }
+    else if constexpr (TZoom == 1)
+    {
+        const __m128i mask = _mm_set1_epi16(0xFF);
+        const __m128i a = _mm_and_si128(_mm_loadu_si128(p), mask);
+        const __m128i b = _mm_and_si128(_mm_loadu_si128(p + 1), mask);
+        return _mm_packus_epi16(a, b);
+    }
+    else if constexpr (TZoom == 2)
+    {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        const __m128i a = _mm_and_si128(_mm_loadu_si128(p), mask);
+        const __m128i b = _mm_and_si128(_mm_loadu_si128(p + 1), mask);
+        const __m128i c = _mm_and_si128(_mm_loadu_si128(p + 2), mask);
+        const __m128i d = _mm_and_si128(_mm_loadu_si128(p + 3), mask);
+        return _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+    }
+    else
+    {
+        const __m128i mask = _mm_set1_epi64x(0xFF);
+        __m128i quarters[4];
+        for (int32_t i = 0; i < 4; i++)
+        {
+            const __m128i a = _mm_and_si128(_mm_loadu_si128(p + i * 2), mask);
+            const __m128i b = _mm_and_si128(_mm_loadu_si128(p + i * 2 + 1), mask);
+            quarters[i] = _mm_packus_epi32(a, b);
+        }
+        return _mm_packus_epi16(
+            _mm_packus_epi32(quarters[0], quarters[1]), _mm_packus_epi32(quarters[2], quarters[3]));
+    }
+}
+
+namespace
+{
+    // A 256 entry palette map split into 16 byte tables for pshufb. Each table holds the XOR of two neighbouring
+    // tables, so XORing every lookup up to and including the right one yields the wanted entry.
+    struct PaletteLookupSse4_1
+    {
+        __m128i lo[8];
+        __m128i hi[8];
+
+        explicit PaletteLookupSse4_1(const PaletteIndex* paletteMap)
+        {
+            __m128i prevLo = {};
+            __m128i prevHi = {};
+            for (int32_t i = 0; i < 8; i++)
+            {
+                const __m128i curLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + i * 16));
+                const __m128i curHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(paletteMap + 128 + i * 16));
+                lo[i] = _mm_xor_si128(curLo, prevLo);
+                hi[i] = _mm_xor_si128(curHi, prevHi);
+                prevLo = curLo;
+                prevHi = curHi;
+            }
+        }
+
+        __m128i Lookup(__m128i index) const
+        {
+            // pshufb yields zero for indices with the top bit set, which covers tables past the index. Tables before
+            // it are cancelled out by the XOR chain. The top bit of the index then selects the lower or upper half.
+            const __m128i step = _mm_set1_epi8(16);
+            __m128i indexLo = index;
+            __m128i indexHi = _mm_xor_si128(index, _mm_set1_epi8(static_cast<char>(0x80)));
+            __m128i resultLo = {};
+            __m128i resultHi = {};
+            for (int32_t i = 0; i < 8; i++)
+            {
+                resultLo = _mm_xor_si128(resultLo, _mm_shuffle_epi8(lo[i], indexLo));
+                resultHi = _mm_xor_si128(resultHi, _mm_shuffle_epi8(hi[i], indexHi));
+                indexLo = _mm_sub_epi8(indexLo, step);
+                indexHi = _mm_sub_epi8(indexHi, step);
+            }
+            return _mm_blendv_epi8(resultLo, resultHi, index);
+        }
+    };
+} // namespace
+
+// Runs the given block operation over every whole block of 16 destination pixels in the run and returns the number
+// of source pixels consumed. Blocks never read past the end of the run.
+template<int32_t TZoom, typename TBlockOp>
+static int32_t ProcessRLERunSse4_1(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, TBlockOp op)
+{
+    constexpr int32_t kBlockPixels = 16 << TZoom;
+    int32_t i = 0;
+    for (; i + kBlockPixels <= numPixels; i += kBlockPixels, dst += 16)
+    {
+        const __m128i pixels = GatherRLERunSse4_1<TZoom>(src + i);
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), op(pixels, dest));
+    }
+    return i;
+}
+
+template<typename TBlockOp>
+static int32_t ProcessRLERunSse4_1(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift, TBlockOp op)
+{
+    switch (zoomShift)
+    {
+        case 0:
+            return ProcessRLERunSse4_1<0>(dst, src, numPixels, op);
+        case 1:
+            return ProcessRLERunSse4_1<1>(dst, src, numPixels, op);
+        case 2:
+            return ProcessRLERunSse4_1<2>(dst, src, numPixels, op);
+        default:
+            return ProcessRLERunSse4_1<3>(dst, src, numPixels, op);
+    }
+}
+
+// Building the lookup tables costs about as much as remapping a few pixels, so short runs are left to the scalar path.
+static constexpr int32_t kMinRLERunLookupPixelsSse4_1 = 32;
+
+void CopyRLERunSse4_1(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift)
+{
+    const __m128i zero = {};
+    const int32_t done = ProcessRLERunSse4_1(dst, src, numPixels, zoomShift, [zero](__m128i pixels, __m128i dest) {
+        return _mm_blendv_epi8(pixels, dest, _mm_cmpeq_epi8(pixels, zero));
+    });
+    CopyRLERunScalar(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift);
+}
+
+void RemapRLERunSse4_1(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    int32_t done = 0;
+    if ((numPixels >> zoomShift) >= kMinRLERunLookupPixelsSse4_1)
+    {
+        const __m128i zero = {};
+        const PaletteLookupSse4_1 lookup(paletteMap);
+        done = ProcessRLERunSse4_1(dst, src, numPixels, zoomShift, [&](__m128i pixels, __m128i dest) {
+            const __m128i remapped = lookup.Lookup(pixels);
+            const __m128i keep = _mm_or_si128(_mm_cmpeq_epi8(pixels, zero), _mm_cmpeq_epi8(remapped, zero));
+            return _mm_blendv_epi8(remapped, dest, keep);
+        });
+    }
+    RemapRLERunScalar(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift, paletteMap);
+}
+
+void GlassRLERunSse4_1(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    int32_t done = 0;
+    if ((numPixels >> zoomShift) >= kMinRLERunLookupPixelsSse4_1)
+    {
+        const __m128i zero = {};
+        const PaletteLookupSse4_1 lookup(paletteMap);
+        done = ProcessRLERunSse4_1(dst, src, numPixels, zoomShift, [&](__m128i pixels, __m128i dest) {
+            const __m128i remapped = lookup.Lookup(dest);
+            const __m128i keep = _mm_or_si128(_mm_cmpeq_epi8(pixels, zero), _mm_cmpeq_epi8(remapped, zero));
+            return _mm_blendv_epi8(remapped, dest, keep);
+        });
+    }
+    GlassRLERunScalar(dst + (done >> zoomShift), src + done, numPixels - done, zoomShift, paletteMap);
+}
+
+void RemapRectSse4_1(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    // The lookup tables are built once for the whole rectangle, so only tiny ones such as borders are left to scalar.
+    if (width < 16 || width * height < kMinRLERunLookupPixelsSse4_1)
+    {
+        RemapRectScalar(dst, width, height, dstWrap, paletteMap);
+        return;
+    }
+
+    const PaletteLookupSse4_1 lookup(paletteMap);
+    for (int32_t yy = 0; yy < height; yy++)
+    {
+        int32_t xx = 0;
+        for (; xx + 16 <= width; xx += 16)
+        {
+            auto* block = reinterpret_cast<__m128i*>(dst + xx);
+            _mm_storeu_si128(block, lookup.Lookup(_mm_loadu_si128(block)));
+        }
+        // The remap is done in place, so the tail cannot be covered by an overlapping block.
+        RemapRectScalar(dst + xx, width - xx, 1, 0, paletteMap);
+        dst += width + dstWrap;
+    }
+}
+
+namespace OpenRCT2::Drawing::LightFx
+{
+    void AccumulateLightSse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity)
+    {
+        uint32_t x = 0;
+        if (intensity == 0xFF)
+        {
+            for (; x + 16 <= count; x += 16)
+            {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(d, s));
+            }
+        }
+        else
+        {
+            // (src * (1 + intensity)) >> 8 fits in 16 bits, so widen to 16 bits, scale and narrow again.
+            const __m128i zero = {};
+            const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(1 + intensity));
+            for (; x + 16 <= count; x += 16)
+            {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x));
+                const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), scale), 8);
+                const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), scale), 8);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(d, _mm_packus_epi16(lo, hi)));
+            }
+        }
+        AccumulateLightScalar(dst + x, src + x, count - x, intensity);
+    }
+
+    void MixLightRowSse4_1(
+        uint32_t* RESTRICT dst, const PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette)
+    {
+        // Each channel is dark + ((light * intensity * 6) >> 8) saturated to 255. The product is computed as the high
+        // half of (light << 8) * (intensity * 6), which is exact and keeps everything in 16-bit lanes.
+        // An intensity of zero yields the dark colour unchanged, matching the scalar early out.
+        const __m128i zero = {};
+        const __m128i six = _mm_set1_epi16(6);
+        const __m128i broadcast = _mm_set1_epi32(0x01010101);
+        uint32_t x = 0;
+        for (; x + 4 <= count; x += 4)
+        {
+            const auto* index = reinterpret_cast<const uint8_t*>(bits + x);
+            const __m128i dark = _mm_setr_epi32(
+                static_cast<int32_t>(palette[index[0]]), static_cast<int32_t>(palette[index[1]]),
+                static_cast<int32_t>(palette[index[2]]), static_cast<int32_t>(palette[index[3]]));
+            const __m128i light = _mm_setr_epi32(
+                static_cast<int32_t>(lightPalette[index[0]]), static_cast<int32_t>(lightPalette[index[1]]),
+                static_cast<int32_t>(lightPalette[index[2]]), static_cast<int32_t>(lightPalette[index[3]]));
+
+            int32_t intensities;
+            std::memcpy(&intensities, lightBits + x, sizeof(intensities));
+            const __m128i intensity = _mm_mullo_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(intensities)), broadcast);
+
+            const __m128i scaleLo = _mm_mullo_epi16(_mm_unpacklo_epi8(intensity, zero), six);
+            const __m128i scaleHi = _mm_mullo_epi16(_mm_unpackhi_epi8(intensity, zero), six);
+            const __m128i lightLo = _mm_mulhi_epu16(_mm_unpacklo_epi8(zero, light), scaleLo);
+            const __m128i lightHi = _mm_mulhi_epu16(_mm_unpackhi_epi8(zero, light), scaleHi);
+            const __m128i mixedLo = _mm_add_epi16(_mm_unpacklo_epi8(dark, zero), lightLo);
+            const __m128i mixedHi = _mm_add_epi16(_mm_unpackhi_epi8(dark, zero), lightHi);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_packus_epi16(mixedLo, mixedHi));
+        }
+        MixLightRowScalar(dst + x, bits + x, lightBits + x, count - x, palette, lightPalette);
+    }
+} // namespace OpenRCT2::Drawing::LightFx
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -71,4 +334,44 @@ void MaskSse4_1(
     OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void CopyRLERunSse4_1(PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void RemapRLERunSse4_1(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void GlassRLERunSse4_1(
+    PaletteIndex* RESTRICT dst, const PaletteIndex* RESTRICT src, int32_t numPixels, int32_t zoomShift,
+    const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void RemapRectSse4_1(
+    PaletteIndex* RESTRICT dst, int32_t width, int32_t height, int32_t dstWrap, const PaletteIndex* RESTRICT paletteMap)
+{
+    OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+namespace OpenRCT2::Drawing::LightFx
+{
+    void AccumulateLightSse4_1(uint8_t* RESTRICT dst, const uint8_t* RESTRICT src, uint32_t count, uint8_t intensity)
+    {
+        OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+    }
+
+    void MixLightRowSse4_1(
+        uint32_t* RESTRICT dst, const PaletteIndex* RESTRICT bits, const uint8_t* RESTRICT lightBits, uint32_t count,
+        const uint32_t* palette, const uint32_t* lightPalette)
+    {
+        OpenRCT2::Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+    }
+} // namespace OpenRCT2::Drawing::LightFx
+
 #endif // __SSE4_1__
@@ -12,10 +12,10 @@
 #include "../Context.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
-#include "../core/Numerics.hpp"
 #include "../interface/Screenshot.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
+#include "../interface/WindowBase.h"
 #include "../scenes/intro/IntroScene.h"
 #include "../ui/UiContext.h"
 #include "BlendColourMap.h"
@@ -345,12 +345,38 @@ void X8DrawingEngine::ConfigureDirtyGrid()
     _invalidationGrid.reset(_width, _height, blockWidth, blockHeight);
 }
 
+/**
+ * Returns whether the main window is the only window drawn in the given region, in which case nothing is drawn over
+ * its viewport and the viewport columns can be left to finish drawing while other regions are drawn.
+ */
+static bool IsRegionOnlyDrawnByMainWindow(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    bool onlyMainWindow = true;
+    WindowVisitEach([&](WindowBase* w) {
+        if (w->flags.has(WindowFlag::dead) || !w->isVisible)
+            return;
+        if (right <= w->windowPos.x || bottom <= w->windowPos.y)
+            return;
+        if (left >= w->windowPos.x + w->width || top >= w->windowPos.y + w->height)
+            return;
+        if (w->classification != WindowClass::mainWindow)
+            onlyMainWindow = false;
+    });
+    return onlyMainWindow;
+}
+
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
     _invalidationGrid.traverseDirtyCells([this](int32_t left, int32_t top, int32_t right, int32_t bottom) {
+        ViewportSetPaintJoinDeferred(IsRegionOnlyDrawnByMainWindow(left, top, right, bottom));
+
         // Draw region
         DrawDirtyBlocks(left, top, right, bottom);
     });
+
+    // Wait for all viewport columns of the frame at once
+    ViewportSetPaintJoinDeferred(false);
+    ViewportJoinPaintJobs();
 }
 
 void X8DrawingEngine::DrawDirtyBlocks(int32_t left, int32_t top, int32_t right, int32_t bottom)
@@ -377,6 +403,13 @@ void X8DrawingContext::Clear(RenderTarget& rt, PaletteIndex paletteIndex)
     int32_t h = rt.height;
     PaletteIndex* ptr = rt.bits;
 
+    // Render targets covering the whole width of their buffer can be filled in one go.
+    if (rt.pitch == 0)
+    {
+        std::fill_n(ptr, static_cast<size_t>(w) * h, paletteIndex);
+        return;
+    }
+
     for (int32_t y = 0; y < h; y++)
     {
         std::fill_n(ptr, w, paletteIndex);
@@ -440,22 +473,13 @@ void X8DrawingContext::FillRect(
         PaletteIndex* dst = startY * rt.LineStride() + startX + rt.bits;
         for (int32_t i = 0; i < height; i++)
         {
-            PaletteIndex* nextdst = dst + rt.LineStride();
-            uint32_t p = Numerics::ror32(crosskPattern, 1);
-            p = (p & 0xFFFF0000) | width;
-
-            // Fill every other pixel with the colour
-            for (; (p & 0xFFFF) != 0; p--)
+            // Fill every other pixel with the colour, starting with the first one on lines where the pattern is even
+            for (int32_t x = crosskPattern & 1; x < width; x += 2)
             {
-                p = p ^ 0x80000000;
-                if (p & 0x80000000)
-                {
-                    *dst = paletteIndex;
-                }
-                dst++;
+                dst[x] = paletteIndex;
             }
             crosskPattern ^= 1;
-            dst = nextdst;
+            dst += rt.LineStride();
         }
     }
     else
@@ -520,21 +544,11 @@ void X8DrawingContext::FilterRect(
     auto paletteMap = GetPaletteMapForColour(palette);
     if (paletteMap.has_value())
     {
-        const auto& paletteEntries = paletteMap.value();
-        const int32_t scaled_width = width;
-        const int32_t step = rt.LineStride();
-
         // Fill the rectangle with the colours from the colour table
-        auto c = height;
-        for (int32_t i = 0; i < c; i++)
-        {
-            PaletteIndex* nextdst = dst + step * i;
-            for (int32_t j = 0; j < scaled_width; j++)
-            {
-                auto index = *(nextdst + j);
-                *(nextdst + j) = paletteEntries[EnumValue(index)];
-            }
-        }
+        // The SIMD kernels load the whole table, shorter maps only cover the colours that are used.
+        const auto paletteEntries = paletteMap->GetData();
+        const auto remapRect = paletteEntries.size() >= 256 ? RemapRectFn : RemapRectScalar;
+        remapRect(dst, width, height, rt.LineStride() - width, paletteEntries.data());
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include "EntityBase.h"
 
+#include "../OpenRCT2.h"
 #include "../core/DataSerialiser.h"
 #include "../core/Guard.hpp"
 #include "../interface/Viewport.h"
@@ -24,7 +25,7 @@ namespace OpenRCT2
 
     void EntityBase::invalidate()
     {
-        if (x == kLocationNull)
+        if (x == kLocationNull || !isPresentationEnabled())
             return;
 
         ZoomLevel maxZoom{ 0 };
@@ -12,6 +12,7 @@
 #include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../OpenRCT2.h"
 #include "../core/Algorithm.hpp"
 #include "../core/ChecksumStream.h"
 #include "../core/Crypt.h"
@@ -34,10 +35,13 @@
 #include "MoneyEffect.h"
 #include "Particle.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <iterator>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace OpenRCT2
@@ -59,6 +63,16 @@ namespace OpenRCT2
         return tileX * kMaximumMapSizeTechnical + tileY;
     }
 
+    // Returns the range of tile indices ComputeSpatialIndex maps the coordinates [lo, hi] of one axis to.
+    static constexpr std::pair<int32_t, int32_t> ComputeSpatialTileSpan(const int32_t lo, const int32_t hi)
+    {
+        if (lo >= 0)
+            return { lo / kCoordsXYStep, hi / kCoordsXYStep };
+        if (hi < 0)
+            return { -hi / kCoordsXYStep, -lo / kCoordsXYStep };
+        return { 0, std::max(-lo, hi) / kCoordsXYStep };
+    }
+
     static constexpr uint32_t GetSpatialIndex(EntityBase& entity)
     {
         return entity.spatialIndex & ~kSpatialIndexDirtyMask;
@@ -121,6 +135,45 @@ namespace OpenRCT2
         return gEntitySpatialIndex[ComputeSpatialIndex(spritePos)];
     }
 
+    bool EntityRegistry::HasLitterInArea(const CoordsXY& minPos, const CoordsXY& maxPos) const
+    {
+        const auto [minTileX, maxTileX] = ComputeSpatialTileSpan(minPos.x, maxPos.x);
+        const auto [minTileY, maxTileY] = ComputeSpatialTileSpan(minPos.y, maxPos.y);
+
+        // Parts of the area outside of the map are looked up in the null bucket.
+        if ((maxTileX >= kMaximumMapSizeTechnical || maxTileY >= kMaximumMapSizeTechnical) && _litterNullBucketCount != 0)
+            return true;
+
+        const auto lastTile = kMaximumMapSizeTechnical - 1;
+        const auto minRegionX = std::min(minTileX, lastTile) >> kLitterRegionShift;
+        const auto maxRegionX = std::min(maxTileX, lastTile) >> kLitterRegionShift;
+        const auto minRegionY = std::min(minTileY, lastTile) >> kLitterRegionShift;
+        const auto maxRegionY = std::min(maxTileY, lastTile) >> kLitterRegionShift;
+        for (auto regionY = minRegionY; regionY <= maxRegionY; regionY++)
+        {
+            for (auto regionX = minRegionX; regionX <= maxRegionX; regionX++)
+            {
+                if (_litterRegionCounts[regionX + (regionY * kLitterRegionsPerSide)] != 0)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    void EntityRegistry::UpdateLitterCount(const uint32_t spatialIndex, const int32_t delta)
+    {
+        if (spatialIndex == kSpatialIndexNullBucket)
+        {
+            _litterNullBucketCount += delta;
+            return;
+        }
+
+        const auto tileX = static_cast<int32_t>(spatialIndex / kMaximumMapSizeTechnical);
+        const auto tileY = static_cast<int32_t>(spatialIndex % kMaximumMapSizeTechnical);
+        const auto regionIndex = (tileX >> kLitterRegionShift) + ((tileY >> kLitterRegionShift) * kLitterRegionsPerSide);
+        _litterRegionCounts[regionIndex] += delta;
+    }
+
     void EntityRegistry::ResetEntityLists()
     {
         for (auto& list : gEntityLists)
@@ -182,6 +235,7 @@ namespace OpenRCT2
         ResetEntityLists();
         ResetFreeIds();
         ResetEntitySpatialIndices();
+        ResetEntityHashes();
     }
 
     /**
@@ -196,6 +250,8 @@ namespace OpenRCT2
         {
             vec.clear();
         }
+        _litterRegionCounts.fill(0);
+        _litterNullBucketCount = 0;
         for (EntityId::UnderlyingType i = 0; i < kMaxEntities; i++)
         {
             auto* entity = GetEntity(EntityId::FromUnderlying(i));
@@ -217,13 +273,118 @@ namespace OpenRCT2
 
         return checksum;
     }
+
+    static uint64_t ComputeEntityHash(EntityBase& entity)
+    {
+        EntitiesChecksum checksum{};
+        ChecksumStream ms(checksum.raw);
+        DataSerialiser ds(true, ms);
+        switch (entity.type)
+        {
+            case EntityType::guest:
+                entity.as<Guest>()->serialise(ds);
+                break;
+            case EntityType::staff:
+                entity.as<Staff>()->serialise(ds);
+                break;
+            case EntityType::vehicle:
+                entity.as<Vehicle>()->serialise(ds);
+                break;
+            case EntityType::litter:
+                entity.as<Litter>()->serialise(ds);
+                break;
+            default:
+                return 0;
+        }
+
+        uint64_t hash;
+        std::memcpy(&hash, checksum.raw.data(), sizeof(hash));
+
+        // The hashes are summed up, so spread them out to keep entities with similar data from cancelling each other.
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return hash != 0 ? hash : 1;
+    }
+
+    EntitiesChecksum EntityRegistry::GetTouchedEntitiesChecksum()
+    {
+        for (const auto entityId : _touchedEntities)
+        {
+            const auto index = entityId.ToUnderlying();
+            _entityTouched[index] = false;
+
+            auto& hash = _entityHashes[index];
+            if (hash != 0)
+            {
+                _entityHashSum -= hash;
+                _entityHashXor ^= hash;
+                _numHashedEntities--;
+            }
+
+            hash = ComputeEntityHash(entities[index].base);
+            if (hash != 0)
+            {
+                _entityHashSum += hash;
+                _entityHashXor ^= hash;
+                _numHashedEntities++;
+            }
+        }
+        _touchedEntities.clear();
+
+        EntitiesChecksum checksum{};
+        std::memcpy(checksum.raw.data(), &_entityHashSum, sizeof(_entityHashSum));
+        std::memcpy(checksum.raw.data() + 8, &_entityHashXor, sizeof(_entityHashXor));
+        std::memcpy(checksum.raw.data() + 16, &_numHashedEntities, sizeof(_numHashedEntities));
+        return checksum;
+    }
 #else
     EntitiesChecksum EntityRegistry::GetAllEntitiesChecksum()
     {
         return EntitiesChecksum{};
     }
+
+    EntitiesChecksum EntityRegistry::GetTouchedEntitiesChecksum()
+    {
+        for (const auto entityId : _touchedEntities)
+        {
+            _entityTouched[entityId.ToUnderlying()] = false;
+        }
+        _touchedEntities.clear();
+        return EntitiesChecksum{};
+    }
 #endif // DISABLE_NETWORK
 
+    void EntityRegistry::MarkEntityTouched(const EntityId entityId)
+    {
+        const auto index = entityId.ToUnderlying();
+        if (index < kMaxEntities && !_entityTouched[index])
+        {
+            _entityTouched[index] = true;
+            _touchedEntities.push_back(entityId);
+        }
+    }
+
+    void EntityRegistry::MarkAllEntitiesTouched()
+    {
+        for (EntityId::UnderlyingType i = 0; i < kMaxEntities; i++)
+        {
+            MarkEntityTouched(EntityId::FromUnderlying(i));
+        }
+    }
+
+    void EntityRegistry::ResetEntityHashes()
+    {
+        _entityHashes.fill(0);
+        _entityTouched.fill(false);
+        _touchedEntities.clear();
+        _entityHashSum = 0;
+        _entityHashXor = 0;
+        _numHashedEntities = 0;
+    }
+
     void EntityRegistry::EntityReset(EntityBase& entity)
     {
         // Need to retain how the sprite is linked in lists
@@ -281,6 +442,7 @@ namespace OpenRCT2
 
         base.type = type;
         AddToEntityList(base);
+        MarkEntityTouched(base.id);
 
         base.x = kLocationNull;
         base.y = kLocationNull;
@@ -375,6 +537,10 @@ namespace OpenRCT2
         auto& spatialVector = gEntitySpatialIndex[newIndex];
 
         Algorithm::sortedInsert(spatialVector, entity.id);
+        if (entity.type == EntityType::litter)
+        {
+            UpdateLitterCount(newIndex, 1);
+        }
 
         entity.spatialIndex = newIndex;
     }
@@ -388,6 +554,10 @@ namespace OpenRCT2
         if (index != std::end(spatialVector))
         {
             spatialVector.erase(index, index + 1);
+            if (entity.type == EntityType::litter)
+            {
+                UpdateLitterCount(currentIndex, -1);
+            }
         }
         else
         {
@@ -461,6 +631,7 @@ namespace OpenRCT2
 
         EntitySpatialRemove(*entity);
         EntityReset(*entity);
+        MarkEntityTouched(entity->id);
     }
 
     /**
@@ -523,6 +694,8 @@ void EntityBase::setLocation(const CoordsXYZ& newLocation)
     y = newLocation.y;
     z = newLocation.z;
 
+    getGameState().entities.MarkEntityTouched(id);
+
     if (spatialIndex & kSpatialIndexDirtyMask)
     {
         // Already marked as dirty.
@@ -541,11 +714,15 @@ void EntityBase::setLocation(const CoordsXYZ& newLocation)
 
 static void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity)
 {
-    auto screenCoords = Translate3DTo2DWithZ(GetCurrentRotation(), entityPos);
+    // The sprite bounds are only used for drawing and audio panning, they are not part of the game state.
+    if (isPresentationEnabled())
+    {
+        auto screenCoords = Translate3DTo2DWithZ(GetCurrentRotation(), entityPos);
 
-    entity->spriteData.spriteRect = ScreenRect(
-        screenCoords - ScreenCoordsXY{ entity->spriteData.width, entity->spriteData.heightMin },
-        screenCoords + ScreenCoordsXY{ entity->spriteData.width, entity->spriteData.heightMax });
+        entity->spriteData.spriteRect = ScreenRect(
+            screenCoords - ScreenCoordsXY{ entity->spriteData.width, entity->spriteData.heightMin },
+            screenCoords + ScreenCoordsXY{ entity->spriteData.width, entity->spriteData.heightMax });
+    }
     entity->setLocation(entityPos);
 }
 
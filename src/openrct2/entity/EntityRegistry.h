@@ -29,6 +29,11 @@ namespace OpenRCT2
     constexpr uint32_t kInvalidSpatialIndex = 0xFFFFFFFFu;
     constexpr uint32_t kSpatialIndexDirtyMask = 1u << 31;
 
+    // Litter is counted per square region of tiles so that staff can skip empty areas without visiting every tile.
+    constexpr int32_t kLitterRegionShift = 3;
+    constexpr int32_t kLitterRegionsPerSide = (kMaximumMapSizeTechnical + (1 << kLitterRegionShift) - 1)
+        >> kLitterRegionShift;
+
     union Entity_t
     {
         uint8_t Pad00[0x200];
@@ -62,6 +67,18 @@ namespace OpenRCT2
 
         std::array<std::vector<EntityId>, kSpatialIndexSize> gEntitySpatialIndex;
 
+        // Mirrors the litter held by gEntitySpatialIndex.
+        std::array<uint16_t, kLitterRegionsPerSide * kLitterRegionsPerSide> _litterRegionCounts{};
+        uint16_t _litterNullBucketCount{};
+
+        // Hash of each entity as of the last GetTouchedEntitiesChecksum call, 0 for entities that are not checksummed.
+        std::array<uint64_t, kMaxEntities> _entityHashes{};
+        std::array<bool, kMaxEntities> _entityTouched{};
+        std::vector<EntityId> _touchedEntities;
+        uint64_t _entityHashSum{};
+        uint64_t _entityHashXor{};
+        uint32_t _numHashedEntities{};
+
     public:
         uint16_t GetEntityListCount(EntityType type);
         uint16_t GetNumFreeEntities();
@@ -108,6 +125,9 @@ namespace OpenRCT2
 
         const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
 
+        // Returns false if no tile list covering the given area contains litter. May return true for empty areas.
+        bool HasLitterInArea(const CoordsXY& minPos, const CoordsXY& maxPos) const;
+
         EntityBase* CreateEntity(EntityType type);
 
         template<typename T>
@@ -152,6 +172,12 @@ namespace OpenRCT2
 
         EntitiesChecksum GetAllEntitiesChecksum();
 
+        // Returns a checksum of the same entities as GetAllEntitiesChecksum, but only hashes the entities that were
+        // created, removed, moved or updated since the previous call. The two checksums are not comparable.
+        EntitiesChecksum GetTouchedEntitiesChecksum();
+        void MarkEntityTouched(EntityId entityId);
+        void MarkAllEntitiesTouched();
+
         template<typename T>
         void MiscUpdateAllType()
         {
@@ -187,7 +213,9 @@ namespace OpenRCT2
         void PrepareNewEntity(EntityBase& base, EntityType type);
         void EntitySpatialInsert(EntityBase& entity, const CoordsXY& newLoc);
         void EntitySpatialRemove(EntityBase& entity);
+        void UpdateLitterCount(uint32_t spatialIndex, int32_t delta);
         void FreeEntity(EntityBase& entity);
+        void ResetEntityHashes();
     };
 
 } // namespace OpenRCT2
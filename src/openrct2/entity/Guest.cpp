@@ -6228,6 +6228,9 @@ namespace OpenRCT2
 
     static PathElement* FindBin(const CoordsXYZ& loc)
     {
+        if (!FootpathBinIndexMayContainBin(loc))
+            return nullptr;
+
         for (auto* pathElement : TileElementsView<PathElement>(loc))
         {
             if (pathElement->getBaseZ() != loc.z)
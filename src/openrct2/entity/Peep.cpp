@@ -202,7 +202,8 @@ namespace OpenRCT2
         if (isInEditorMode())
             return;
 
-        const auto currentTicks = getGameState().currentTicks;
+        auto& gameState = getGameState();
+        const auto currentTicks = gameState.currentTicks;
 
         constexpr auto kTicks128Mask = 128u - 1u;
         const auto currentTicksMasked = currentTicks & kTicks128Mask;
@@ -216,6 +217,7 @@ namespace OpenRCT2
                 peep->tick128UpdateGuest(index);
             }
 
+            gameState.entities.MarkEntityTouched(peep->id);
             peep->update();
 
             index++;
@@ -228,6 +230,7 @@ namespace OpenRCT2
                 staff->tick128UpdateStaff();
             }
 
+            gameState.entities.MarkEntityTouched(staff->id);
             staff->Update();
 
             index++;
@@ -600,10 +603,14 @@ namespace OpenRCT2
      */
     void PeepWindowStateUpdate(Peep* peep)
     {
+        const bool hasPresentation = isPresentationEnabled();
         auto* windowMgr = Ui::GetWindowManager();
-        WindowBase* w = windowMgr->FindByNumber(WindowClass::peep, peep->id.ToUnderlying());
-        if (w != nullptr)
-            w->onPrepareDraw();
+        if (hasPresentation)
+        {
+            WindowBase* w = windowMgr->FindByNumber(WindowClass::peep, peep->id.ToUnderlying());
+            if (w != nullptr)
+                w->onPrepareDraw();
+        }
 
         if (peep->is<Guest>())
         {
@@ -617,10 +624,13 @@ namespace OpenRCT2
                 }
             }
 
-            windowMgr->InvalidateByNumber(WindowClass::peep, peep->id);
-            windowMgr->InvalidateByClass(WindowClass::guestList);
+            if (hasPresentation)
+            {
+                windowMgr->InvalidateByNumber(WindowClass::peep, peep->id);
+                windowMgr->InvalidateByClass(WindowClass::guestList);
+            }
         }
-        else
+        else if (hasPresentation)
         {
             windowMgr->InvalidateByNumber(WindowClass::peep, peep->id);
             windowMgr->InvalidateByClass(WindowClass::staffList);
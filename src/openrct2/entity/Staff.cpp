@@ -316,6 +316,12 @@ namespace OpenRCT2
         constexpr auto kTileRadius = 3;
         constexpr auto kLookupRadius = kCoordsXYStep * kTileRadius;
 
+        if (!getGameState().entities.HasLitterInArea(
+                { x - kLookupRadius, y - kLookupRadius }, { x + kLookupRadius, y + kLookupRadius }))
+        {
+            return kInvalidDirection;
+        }
+
         auto nearestLitterDist = std::numeric_limits<int32_t>::max();
         Litter* nearestLitter = nullptr;
 
@@ -1532,6 +1538,9 @@ namespace OpenRCT2
         if (GetNextIsSurface())
             return false;
 
+        if (!FootpathBinIndexMayContainBin(NextLoc))
+            return false;
+
         TileElement* tileElement = MapGetFirstElementAt(NextLoc);
         if (tileElement == nullptr)
             return false;
@@ -1624,6 +1633,8 @@ namespace OpenRCT2
     {
         if (!(staffOrders & STAFF_ORDERS_SWEEPING))
             return false;
+        if (!getGameState().entities.HasLitterInArea({ x, y }, { x, y }))
+            return false;
         auto quad = EntityTileList<Litter>({ x, y });
         for (auto litter : quad)
         {
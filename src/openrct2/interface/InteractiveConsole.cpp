@@ -1249,8 +1249,7 @@ static void ConsoleCommandRemoveFloatingObjects(InteractiveConsole& console, con
 
 static void ConsoleCommandShowLimits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    const auto& tileElements = GetTileElements();
-    const auto tileElementCount = tileElements.size();
+    const auto tileElementCount = GetTileElementCount();
 
     int32_t rideCount = RideGetCount();
     int32_t spriteCount = 0;
@@ -1525,6 +1524,46 @@ static void ConsoleCommandReplayStop(InteractiveConsole& console, const argument
     }
 }
 
+static void ConsoleCommandReplaySeek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (Network::GetMode() != Network::Mode::none)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return;
+    }
+
+    if (argv.empty())
+    {
+        console.WriteFormatLine("Parameters required <tick>");
+        return;
+    }
+
+    auto* replayManager = GetContext()->GetReplayManager();
+    if (!replayManager->IsReplaying())
+    {
+        console.WriteFormatLine("No replay is playing.");
+        return;
+    }
+
+    const auto tick = static_cast<uint32_t>(std::strtoul(argv[0].c_str(), nullptr, 10));
+    try
+    {
+        const auto keyframeTick = replayManager->SeekPlayback(tick);
+
+        // Simulate the remaining ticks from the keyframe.
+        auto& gameState = getGameState();
+        while (replayManager->IsReplaying() && gameState.currentTicks < tick)
+        {
+            gameStateUpdateLogic();
+        }
+        console.WriteFormatLine("Seeked to tick %u from keyframe at tick %u", gameState.currentTicks, keyframeTick);
+    }
+    catch (const std::exception& e)
+    {
+        console.WriteLine(e.what());
+    }
+}
+
 static void ConsoleCommandReplayNormalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (Network::GetMode() != Network::Mode::none)
@@ -1716,6 +1755,11 @@ static void ConsoleCommandProfilerStatus([[maybe_unused]] InteractiveConsole& co
         console.WriteFormatLine("Total recorded calls: %llu", static_cast<unsigned long long>(totalCalls));
         console.WriteFormatLine("Total recorded time: %.3f ms", totalTimeUs / 1000.0);
     }
+
+    for (const auto* counter : Profiling::getCounters())
+    {
+        console.WriteFormatLine("%s: %llu", counter->getName(), static_cast<unsigned long long>(counter->getValue()));
+    }
 }
 
 static void ConsoleCommandProfilerStart([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -1743,6 +1787,24 @@ static void ConsoleCommandProfilerExport([[maybe_unused]] InteractiveConsole& co
     console.WriteFormatLine("Wrote profiler data: \"%s\"", filePath.c_str());
 }
 
+static void ConsoleCommandProfilerTrace([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.empty())
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return;
+    }
+
+    const auto& filePath = argv[0];
+    if (!Profiling::exportTrace(filePath))
+    {
+        console.WriteFormatLine("Unable to export profiler trace to %s", filePath.c_str());
+        return;
+    }
+
+    console.WriteFormatLine("Wrote profiler trace: \"%s\"", filePath.c_str());
+}
+
 static void ConsoleCommandProfilerStop([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     if (Profiling::isEnabled())
@@ -1872,6 +1934,7 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "replay_stoprecord", ConsoleCommandReplayStopRecord, "Stops recording a new replay.", "replay_stoprecord" },
     { "replay_start", ConsoleCommandReplayStart, "Starts a replay", "replay_start <name>" },
     { "replay_stop", ConsoleCommandReplayStop, "Stops the replay", "replay_stop" },
+    { "replay_seek", ConsoleCommandReplaySeek, "Seeks the playing replay to the given game tick", "replay_seek <tick>" },
     { "replay_normalise", ConsoleCommandReplayNormalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", ConsoleCommandMpDesync, "Forces a multiplayer desync",
@@ -1883,6 +1946,9 @@ static constexpr ConsoleCommand console_command_table[] = {
       "profiler_stop [<file.csv|file.json>]" },
     { "profiler_export", ConsoleCommandProfilerExport, "Exports profiler data (format from extension, default CSV).",
       "profiler_export <file.csv|file.json>" },
+    { "profiler_trace", ConsoleCommandProfilerTrace,
+      "Exports the recent calls of all threads as a Chrome trace, which can be opened in Perfetto.",
+      "profiler_trace <file.json>" },
 };
 
 static void ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
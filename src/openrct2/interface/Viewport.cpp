@@ -68,6 +68,8 @@ namespace OpenRCT2
 
     static std::unique_ptr<JobPool> _paintJobs;
     static std::vector<PaintSession*> _paintColumns;
+    static size_t _lastPaintEntryCount;
+    static bool _paintJoinDeferred;
 
     InteractionInfo::InteractionInfo(const PaintStruct* ps)
         : Loc(ps->MapPos)
@@ -834,6 +836,44 @@ namespace OpenRCT2
         ViewportPaint(viewport, rt);
     }
 
+    /**
+     * Returns the number of paint entries that were generated by the viewport paints of the most recent join.
+     */
+    size_t ViewportGetLastPaintEntryCount()
+    {
+        return _lastPaintEntryCount;
+    }
+
+    /**
+     * When deferred, viewport paints that draw their columns in parallel return as soon as the columns have been
+     * queued. The caller must make sure nothing else is drawn over the viewport until ViewportJoinPaintJobs is called.
+     */
+    void ViewportSetPaintJoinDeferred(bool deferred)
+    {
+        _paintJoinDeferred = deferred;
+    }
+
+    /**
+     * Waits for all queued viewport columns to be drawn and releases their paint sessions.
+     */
+    void ViewportJoinPaintJobs()
+    {
+        PROFILED_FUNCTION();
+
+        if (_paintJobs != nullptr)
+        {
+            _paintJobs->Join();
+        }
+
+        _lastPaintEntryCount = 0;
+        for (auto* session : _paintColumns)
+        {
+            _lastPaintEntryCount += session->paintEntries.size();
+            PaintSessionFree(session);
+        }
+        _paintColumns.clear();
+    }
+
     static void ViewportFillColumn(PaintSession& session)
     {
         PROFILED_FUNCTION();
@@ -904,8 +944,6 @@ namespace OpenRCT2
         worldRT.pitch = rt.LineStride() - worldRT.width;
         worldRT.zoom_level = viewport->zoom;
 
-        _paintColumns.clear();
-
         bool useMultithreading = Config::Get().general.multiThreading;
         if (useMultithreading && _paintJobs == nullptr)
         {
@@ -913,6 +951,7 @@ namespace OpenRCT2
         }
         else if (useMultithreading == false && _paintJobs != nullptr)
         {
+            ViewportJoinPaintJobs();
             _paintJobs.reset();
         }
 
@@ -926,7 +965,9 @@ namespace OpenRCT2
         const int32_t rightBorder = worldRT.x + worldRT.width;
         const int32_t alignedX = floor2(worldRT.x, columnWidth);
 
-        // Generate and sort columns.
+        // Generate and sort columns. With parallel drawing each column is also drawn as part of the same job, so columns
+        // never have to wait for each other.
+        const size_t firstColumn = _paintColumns.size();
         for (int32_t x = alignedX; x < rightBorder; x += columnWidth)
         {
             PaintSession* session = PaintSessionAlloc(worldRT, viewport->flags, viewport->rotation);
@@ -960,7 +1001,14 @@ namespace OpenRCT2
             columnRT.cullingWidth = columnWidth;
             columnRT.cullingHeight = cullingY * 2;
 
-            if (useMultithreading)
+            if (useParallelDrawing)
+            {
+                _paintJobs->AddTask([session]() -> void {
+                    ViewportFillColumn(*session);
+                    ViewportPaintColumn(*session);
+                });
+            }
+            else if (useMultithreading)
             {
                 _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
             }
@@ -970,32 +1018,23 @@ namespace OpenRCT2
             }
         }
 
-        if (useMultithreading)
+        if (!useParallelDrawing)
         {
-            _paintJobs->Join();
-        }
-
-        // Paint columns.
-        for (auto* session : _paintColumns)
-        {
-            if (useParallelDrawing)
+            if (useMultithreading)
             {
-                _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
+                _paintJobs->Join();
             }
-            else
+
+            // Paint columns.
+            for (size_t i = firstColumn; i < _paintColumns.size(); i++)
             {
-                ViewportPaintColumn(*session);
+                ViewportPaintColumn(*_paintColumns[i]);
             }
         }
-        if (useParallelDrawing)
-        {
-            _paintJobs->Join();
-        }
 
-        // Release resources.
-        for (auto* session : _paintColumns)
+        if (!useParallelDrawing || !_paintJoinDeferred)
         {
-            PaintSessionFree(session);
+            ViewportJoinPaintJobs();
         }
     }
 
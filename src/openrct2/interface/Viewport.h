@@ -201,6 +201,9 @@ namespace OpenRCT2
     void ViewportRotateSingle(WindowBase* window, int32_t direction);
     void ViewportRotateAll(int32_t direction);
     void ViewportRender(Drawing::RenderTarget& rt, const Viewport* viewport);
+    size_t ViewportGetLastPaintEntryCount();
+    void ViewportSetPaintJoinDeferred(bool deferred);
+    void ViewportJoinPaintJobs();
 
     CoordsXYZ ViewportAdjustForMapHeight(const ScreenCoordsXY& startCoords, uint8_t rotation);
 
@@ -240,6 +240,7 @@ namespace OpenRCT2::Network
         }
         else if (mode == Mode::server)
         {
+            _ioThread.reset();
             _listenSocket.reset();
             _advertiser.reset();
         }
@@ -374,6 +375,11 @@ namespace OpenRCT2::Network
             return false;
         }
 
+        if (Config::Get().network.serverNetworkThread)
+        {
+            _ioThread = std::make_unique<IOThread>(*_listenSocket);
+        }
+
         ServerName = Config::Get().network.serverName;
         ServerDescription = Config::Get().network.serverDescription;
         ServerGreeting = Config::Get().network.serverGreeting;
@@ -517,6 +523,10 @@ namespace OpenRCT2::Network
         {
             _serverConnection->sendQueuedData();
         }
+        else if (_ioThread != nullptr)
+        {
+            _ioThread->wake();
+        }
         else
         {
             for (auto& it : client_connection_list)
@@ -572,10 +582,20 @@ namespace OpenRCT2::Network
             _advertiser->update();
         }
 
-        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-        if (tcpSocket != nullptr)
+        if (_ioThread != nullptr)
+        {
+            while (auto tcpSocket = _ioThread->acceptClient())
+            {
+                AddClient(std::move(tcpSocket));
+            }
+        }
+        else
         {
-            AddClient(std::move(tcpSocket));
+            std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+            if (tcpSocket != nullptr)
+            {
+                AddClient(std::move(tcpSocket));
+            }
         }
     }
 
@@ -825,6 +845,7 @@ namespace OpenRCT2::Network
 
     void NetworkBase::SendPacketToClients(const Packet& packet, bool front, bool gameCmd) const
     {
+        BroadcastPacket broadcast(packet);
         for (auto& client_connection : client_connection_list)
         {
             if (gameCmd)
@@ -838,7 +859,7 @@ namespace OpenRCT2::Network
                     continue;
                 }
             }
-            client_connection->queuePacket(packet, front);
+            client_connection->queuePacket(broadcast, front);
         }
     }
 
@@ -2092,6 +2113,10 @@ namespace OpenRCT2::Network
             }
 
             // Make sure to send all remaining packets out before disconnecting.
+            if (_ioThread != nullptr)
+            {
+                _ioThread->removeConnection(*connection);
+            }
             connection->sendQueuedData();
             connection->socket->Disconnect();
 
@@ -2112,6 +2137,10 @@ namespace OpenRCT2::Network
         // Store connection
         auto connection = std::make_unique<Connection>();
         connection->socket = std::move(socket);
+        if (_ioThread != nullptr)
+        {
+            _ioThread->addConnection(*connection);
+        }
 
         client_connection_list.push_back(std::move(connection));
     }
@@ -5,6 +5,7 @@
 #include "../scenario/Scenario.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkIOThread.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -204,6 +205,7 @@ namespace OpenRCT2::Network
     private: // Server Data
         std::unordered_map<Command, CommandHandler> server_command_handlers;
         std::unique_ptr<ITcpSocket> _listenSocket;
+        std::unique_ptr<IOThread> _ioThread;
         std::unique_ptr<INetworkServerAdvertiser> _advertiser;
         std::list<std::unique_ptr<Connection>> client_connection_list;
         std::string _serverLogPath;
@@ -20,7 +20,8 @@
     #include "Network.h"
     #include "Socket.h"
 
-    #include <sfl/small_vector.hpp>
+    #include <array>
+    #include <span>
 
 namespace OpenRCT2::Network
 {
@@ -35,7 +36,8 @@ namespace OpenRCT2::Network
 
     void Connection::update()
     {
-        if (!isValid())
+        // The I/O thread does the reading and sending for connections it serves.
+        if (!isValid() || _hasIOThread)
         {
             return;
         }
@@ -64,6 +66,34 @@ namespace OpenRCT2::Network
     }
 
     ReadPacket Connection::readPacket()
+    {
+        if (_hasIOThread)
+        {
+            // The thread queues everything it has received before flagging the connection as closed, so check the flag
+            // first to not miss any of it.
+            const bool closed = _ioClosed.load(std::memory_order_acquire);
+            if (!_receivedPackets.pop(inboundPacket))
+            {
+                return closed ? ReadPacket::disconnected : ReadPacket::noData;
+            }
+
+            recordPacketStats(inboundPacket, false);
+            return ReadPacket::success;
+        }
+
+        const auto status = frameInboundPacket(inboundPacket);
+        if (status == ReadPacket::success)
+        {
+            recordPacketStats(inboundPacket, false);
+        }
+        else if (status == ReadPacket::disconnected)
+        {
+            disconnect();
+        }
+        return status;
+    }
+
+    ReadPacket Connection::frameInboundPacket(Packet& packet)
     {
         uint32_t magic = 0;
 
@@ -83,7 +113,7 @@ namespace OpenRCT2::Network
         if (magic == PacketHeader::kMagic)
         {
             // New format.
-            auto& header = inboundPacket.header;
+            auto& header = packet.header;
             std::memcpy(&header, _inboundBuffer.data(), sizeof(header));
 
             header.magic = magic;
@@ -114,16 +144,15 @@ namespace OpenRCT2::Network
                     "Received malformed packet (size: %u) from {%s}, disconnecting.", header.size,
                     socket->GetIpAddress().c_str());
 
-                disconnect();
                 return ReadPacket::disconnected;
             }
 
             header.size -= sizeof(header.id);
 
             // Fill in new header format.
-            inboundPacket.header.magic = PacketHeader::kMagic;
-            inboundPacket.header.size = header.size;
-            inboundPacket.header.id = header.id;
+            packet.header.magic = PacketHeader::kMagic;
+            packet.header.size = header.size;
+            packet.header.id = header.id;
 
             headerSize = sizeof(header);
             totalPacketLength = sizeof(header) + header.size;
@@ -133,25 +162,24 @@ namespace OpenRCT2::Network
 
         if (_inboundBuffer.size() < totalPacketLength)
         {
-            inboundPacket.bytesTransferred = _inboundBuffer.size();
+            packet.bytesTransferred = _inboundBuffer.size();
             return ReadPacket::moreData;
         }
 
         // Read packet body.
-        inboundPacket.bytesTransferred = totalPacketLength;
-        inboundPacket.write(_inboundBuffer.data() + headerSize, totalPacketLength - headerSize);
+        packet.bytesTransferred = totalPacketLength;
+        packet.write(_inboundBuffer.data() + headerSize, totalPacketLength - headerSize);
 
         // Remove read data from buffer.
         _inboundBuffer.erase(_inboundBuffer.begin(), _inboundBuffer.begin() + totalPacketLength);
 
-        recordPacketStats(inboundPacket, false);
-
         return ReadPacket::success;
     }
 
-    static sfl::small_vector<uint8_t, 512> serializePacket(bool legacyProtocol, const Packet& packet)
+    static SerialisedPacket serializePacket(bool legacyProtocol, const Packet& packet)
     {
-        sfl::small_vector<uint8_t, 512> buffer;
+        auto buffer = std::make_shared<std::vector<uint8_t>>();
+        buffer->reserve(sizeof(PacketHeader) + packet.data.size());
 
         if (legacyProtocol)
         {
@@ -166,8 +194,8 @@ namespace OpenRCT2::Network
             header.size = Convert::HostToNetwork(header.size);
             header.id = ByteSwapBE(packet.header.id);
 
-            buffer.insert(
-                buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+            buffer->insert(
+                buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
         }
         else
         {
@@ -177,33 +205,108 @@ namespace OpenRCT2::Network
             header.size = Convert::HostToNetwork(static_cast<uint32_t>(packet.data.size()));
             header.id = Convert::HostToNetwork(packet.header.id);
 
-            buffer.insert(
-                buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+            buffer->insert(
+                buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
         }
 
-        buffer.insert(buffer.end(), packet.data.begin(), packet.data.end());
+        buffer->insert(buffer->end(), packet.data.begin(), packet.data.end());
 
         return buffer;
     }
 
+    BroadcastPacket::BroadcastPacket(const Packet& packet) noexcept
+        : _packet(packet)
+    {
+    }
+
+    const Packet& BroadcastPacket::getPacket() const noexcept
+    {
+        return _packet;
+    }
+
+    const SerialisedPacket& BroadcastPacket::getSerialised(bool legacyProtocol)
+    {
+        auto& serialised = legacyProtocol ? _serialisedLegacy : _serialised;
+        if (serialised == nullptr)
+        {
+            serialised = serializePacket(legacyProtocol, _packet);
+        }
+        return serialised;
+    }
+
     void Connection::queuePacket(const Packet& packet, bool front)
     {
+        BroadcastPacket broadcast(packet);
+        queuePacket(broadcast, front);
+    }
+
+    void Connection::queuePacket(BroadcastPacket& broadcast, bool front)
+    {
+        const auto& packet = broadcast.getPacket();
         if (authStatus == Auth::ok || !packet.commandRequiresAuth())
         {
-            const auto payload = serializePacket(_isLegacyProtocol, packet);
-            if (front)
+            const auto& data = broadcast.getSerialised(_isLegacyProtocol);
+            if (_hasIOThread)
             {
-                _outboundBuffer.insert(_outboundBuffer.begin(), payload.begin(), payload.end());
+                _queuedData.push({ data, front });
             }
             else
             {
-                _outboundBuffer.insert(_outboundBuffer.end(), payload.begin(), payload.end());
+                enqueueOutbound(data, front);
             }
 
             recordPacketStats(packet, true);
         }
     }
 
+    void Connection::enqueueOutbound(SerialisedPacket data, bool front)
+    {
+        if (front && !_outboundQueue.empty())
+        {
+            // The rest of a packet that has been sent in part has to go out before anything else.
+            auto position = _outboundQueueSent != 0 ? std::next(_outboundQueue.begin()) : _outboundQueue.begin();
+            _outboundQueue.insert(position, std::move(data));
+        }
+        else
+        {
+            _outboundQueue.push_back(std::move(data));
+        }
+    }
+
+    void Connection::sendOutbound()
+    {
+        // Gathering more packets than this into a single write does not make it any cheaper.
+        static constexpr size_t kMaxBuffersPerSend = 64;
+
+        std::array<std::span<const uint8_t>, kMaxBuffersPerSend> buffers;
+        while (!_outboundQueue.empty())
+        {
+            size_t count = 0;
+            size_t bytesQueued = 0;
+            for (auto it = _outboundQueue.begin(); it != _outboundQueue.end() && count < buffers.size(); it++)
+            {
+                buffers[count] = std::span<const uint8_t>(**it).subspan(count == 0 ? _outboundQueueSent : 0);
+                bytesQueued += buffers[count].size();
+                count++;
+            }
+
+            const auto bytesSent = socket->SendBuffers({ buffers.data(), count });
+
+            auto bytesDone = _outboundQueueSent + bytesSent;
+            while (!_outboundQueue.empty() && bytesDone >= _outboundQueue.front()->size())
+            {
+                bytesDone -= _outboundQueue.front()->size();
+                _outboundQueue.pop_front();
+            }
+            _outboundQueueSent = bytesDone;
+
+            if (bytesSent < bytesQueued)
+            {
+                break;
+            }
+        }
+    }
+
     void Connection::disconnect() noexcept
     {
         shouldDisconnect = true;
@@ -216,24 +319,87 @@ namespace OpenRCT2::Network
 
     void Connection::sendQueuedData()
     {
-        if (_outboundBuffer.empty())
+        if (!_hasIOThread)
         {
-            return;
+            sendOutbound();
+        }
+    }
+
+    void Connection::receiveDataOnIOThread()
+    {
+        // Read everything the socket has to offer, up to a limit so that a single client can not keep the thread busy.
+        static constexpr size_t kMaxReads = 16;
+
+        uint8_t buffer[kBufferSize];
+        bool closed = false;
+        for (size_t i = 0; i < kMaxReads; i++)
+        {
+            size_t bytesRead = 0;
+            const auto status = socket->ReceiveData(buffer, sizeof(buffer), &bytesRead);
+            if (status == ReadPacket::disconnected)
+            {
+                closed = true;
+                break;
+            }
+            if (status != ReadPacket::success)
+            {
+                break;
+            }
+
+            _lastReceiveTime.store(Platform::GetTicks(), std::memory_order_relaxed);
+            _inboundBuffer.insert(_inboundBuffer.end(), buffer, buffer + bytesRead);
+            if (bytesRead < sizeof(buffer))
+            {
+                break;
+            }
+        }
+
+        Packet packet;
+        ReadPacket status;
+        while ((status = frameInboundPacket(packet)) == ReadPacket::success)
+        {
+            _receivedPackets.push(std::move(packet));
+            packet = {};
+        }
+
+        if (closed || status == ReadPacket::disconnected)
+        {
+            _ioClosed.store(true, std::memory_order_release);
         }
+    }
 
-        const auto bytesSent = socket->SendData(_outboundBuffer.data(), _outboundBuffer.size());
+    void Connection::sendDataOnIOThread()
+    {
+        QueuedData queued;
+        while (_queuedData.pop(queued))
+        {
+            enqueueOutbound(std::move(queued.data), queued.front);
+        }
+        sendOutbound();
+    }
 
-        if (bytesSent > 0)
+    bool Connection::hasDataToSendOnIOThread() const noexcept
+    {
+        return !_outboundQueue.empty();
+    }
+
+    void Connection::detachIOThread()
+    {
+        // Hand the data that has not been sent yet back to sendQueuedData, packets that have been received but not read
+        // are of no use to a connection that is leaving the thread.
+        QueuedData queued;
+        while (_queuedData.pop(queued))
         {
-            _outboundBuffer.erase(_outboundBuffer.begin(), _outboundBuffer.begin() + bytesSent);
+            enqueueOutbound(std::move(queued.data), queued.front);
         }
+        _hasIOThread = false;
     }
 
     bool Connection::receivedDataRecently() const noexcept
     {
         constexpr auto kTimeoutMs = kNoDataTimeout * 1000;
 
-        const auto timeSinceLastRecv = Platform::GetTicks() - _lastReceiveTime;
+        const auto timeSinceLastRecv = Platform::GetTicks() - _lastReceiveTime.load(std::memory_order_relaxed);
         if (timeSinceLastRecv > kTimeoutMs)
         {
             return false;
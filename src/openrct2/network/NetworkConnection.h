@@ -11,11 +11,14 @@
 
 #ifndef DISABLE_NETWORK
 
+    #include "../core/SpscQueue.hpp"
     #include "NetworkKey.h"
     #include "NetworkPacket.h"
     #include "NetworkTypes.h"
     #include "Socket.h"
 
+    #include <atomic>
+    #include <deque>
     #include <memory>
     #include <string_view>
     #include <vector>
@@ -27,8 +30,29 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Network
 {
+    class IOThread;
     class Player;
 
+    using SerialisedPacket = std::shared_ptr<const std::vector<uint8_t>>;
+
+    /**
+     * A packet that is sent to several connections. It is serialised once for each protocol the connections use and the
+     * serialised data is shared by their outbound queues.
+     */
+    class BroadcastPacket final
+    {
+    public:
+        explicit BroadcastPacket(const Packet& packet) noexcept;
+
+        const Packet& getPacket() const noexcept;
+        const SerialisedPacket& getSerialised(bool legacyProtocol);
+
+    private:
+        const Packet& _packet;
+        SerialisedPacket _serialised;
+        SerialisedPacket _serialisedLegacy;
+    };
+
     class Connection final
     {
     public:
@@ -48,6 +72,7 @@ namespace OpenRCT2::Network
         void update();
         ReadPacket readPacket();
         void queuePacket(const Packet& packet, bool front = false);
+        void queuePacket(BroadcastPacket& packet, bool front = false);
 
         Command getPendingPacketCommand() const noexcept;
         size_t getPendingPacketSize() const noexcept;
@@ -66,14 +91,39 @@ namespace OpenRCT2::Network
         void setLastDisconnectReason(StringId string_id, void* args = nullptr);
 
     private:
+        friend class IOThread;
+
+        struct QueuedData
+        {
+            SerialisedPacket data;
+            bool front{};
+        };
+
+        // While the connection is served by an I/O thread, the thread owns the socket, the inbound buffer and the outbound
+        // queue. Complete packets and serialised outbound packets are then exchanged with it through the SPSC queues.
         std::vector<uint8_t> _inboundBuffer;
-        std::vector<uint8_t> _outboundBuffer;
-        uint32_t _lastReceiveTime = 0;
+        std::deque<SerialisedPacket> _outboundQueue;
+        // How much of the packet at the front of the outbound queue has been sent already.
+        size_t _outboundQueueSent = 0;
+        SpscQueue<Packet> _receivedPackets;
+        SpscQueue<QueuedData> _queuedData;
+        std::atomic<uint32_t> _lastReceiveTime = 0;
+        std::atomic<bool> _ioClosed = false;
         std::string _lastDisconnectReason;
-        bool _isLegacyProtocol = false;
+        std::atomic<bool> _isLegacyProtocol = false;
+        bool _hasIOThread = false;
 
         void recordPacketStats(const Packet& packet, bool sending);
         void receiveData();
+        void enqueueOutbound(SerialisedPacket data, bool front);
+        void sendOutbound();
+        ReadPacket frameInboundPacket(Packet& packet);
+
+        // Called by the I/O thread.
+        void receiveDataOnIOThread();
+        void sendDataOnIOThread();
+        bool hasDataToSendOnIOThread() const noexcept;
+        void detachIOThread();
     };
 } // namespace OpenRCT2::Network
 
@@ -0,0 +1,162 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+    #include "NetworkIOThread.h"
+
+    #include "../Diagnostic.h"
+    #include "NetworkConnection.h"
+
+    #include <algorithm>
+    #include <chrono>
+
+namespace OpenRCT2::Network
+{
+    // Wake ups and socket activity end the wait early, the timeout only bounds how long a missed wake up can delay sending.
+    static constexpr auto kWaitTimeout = std::chrono::milliseconds(50);
+
+    IOThread::IOThread(ITcpSocket& listenSocket)
+        : _listenSocket(listenSocket)
+        , _poller(CreateSocketPoller())
+    {
+        _thread = std::thread([this] { run(); });
+    }
+
+    IOThread::~IOThread()
+    {
+        _stopping = true;
+        _poller->Wake();
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+
+        for (auto* connection : _connections)
+        {
+            connection->detachIOThread();
+        }
+    }
+
+    void IOThread::addConnection(Connection& connection)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            connection._hasIOThread = true;
+            _connections.push_back(&connection);
+        }
+        _poller->Wake();
+    }
+
+    void IOThread::removeConnection(Connection& connection)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            auto it = std::find(_connections.begin(), _connections.end(), &connection);
+            if (it == _connections.end())
+            {
+                return;
+            }
+            _connections.erase(it);
+            connection.detachIOThread();
+        }
+
+        // Wait for the thread to stop waiting on a list of sockets that may still include this connection's.
+        _poller->Wake();
+        std::lock_guard waitLock(_waitMutex);
+    }
+
+    std::unique_ptr<ITcpSocket> IOThread::acceptClient()
+    {
+        std::unique_ptr<ITcpSocket> socket;
+        _acceptedSockets.pop(socket);
+        return socket;
+    }
+
+    void IOThread::wake()
+    {
+        _poller->Wake();
+    }
+
+    void IOThread::run()
+    {
+        std::vector<SocketPollEntry> entries;
+        std::vector<Connection*> polledConnections;
+        while (!_stopping)
+        {
+            {
+                std::lock_guard waitLock(_waitMutex);
+                entries.clear();
+                polledConnections.clear();
+                entries.push_back({ &_listenSocket });
+                {
+                    std::lock_guard lock(_mutex);
+                    for (auto* connection : _connections)
+                    {
+                        // Closed connections keep reporting activity until the game thread gets round to removing them.
+                        if (connection->_ioClosed.load(std::memory_order_relaxed))
+                            continue;
+
+                        entries.push_back({ connection->socket.get(), connection->hasDataToSendOnIOThread() });
+                        polledConnections.push_back(connection);
+                    }
+                }
+                _poller->Wait(entries, kWaitTimeout);
+            }
+
+            if (_stopping)
+                break;
+
+            if (entries[0].readable)
+            {
+                acceptClients();
+            }
+
+            std::lock_guard lock(_mutex);
+            for (size_t i = 0; i < polledConnections.size(); i++)
+            {
+                auto* connection = polledConnections[i];
+                if (std::find(_connections.begin(), _connections.end(), connection) == _connections.end())
+                    continue;
+
+                try
+                {
+                    if (entries[i + 1].readable)
+                    {
+                        connection->receiveDataOnIOThread();
+                    }
+                    // Always called, data the game thread has queued since the last wake up is picked up here.
+                    connection->sendDataOnIOThread();
+                }
+                catch (const std::exception& ex)
+                {
+                    LOG_VERBOSE("Network thread failed to service connection: %s", ex.what());
+                    connection->_ioClosed.store(true, std::memory_order_release);
+                }
+            }
+        }
+    }
+
+    void IOThread::acceptClients()
+    {
+        try
+        {
+            while (auto socket = _listenSocket.Accept())
+            {
+                _acceptedSockets.push(std::move(socket));
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            LOG_ERROR("Failed to accept client: %s", ex.what());
+        }
+    }
+} // namespace OpenRCT2::Network
+
+#endif // DISABLE_NETWORK
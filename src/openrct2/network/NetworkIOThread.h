@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+    #include "../core/SpscQueue.hpp"
+    #include "Socket.h"
+
+    #include <atomic>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+namespace OpenRCT2::Network
+{
+    class Connection;
+
+    /**
+     * Accepts clients on the listening socket and does all reading and sending for the connections it serves on a thread of
+     * its own, which waits for socket activity instead of polling every connection. Inbound data is framed into packets on
+     * that thread, so the game thread only ever exchanges complete packets with it.
+     */
+    class IOThread final
+    {
+    public:
+        // The listening socket must outlive the thread.
+        explicit IOThread(ITcpSocket& listenSocket);
+        ~IOThread();
+
+        // The connection is served by the thread until it is removed, it must not be destroyed before then.
+        void addConnection(Connection& connection);
+        void removeConnection(Connection& connection);
+
+        [[nodiscard]] std::unique_ptr<ITcpSocket> acceptClient();
+
+        // Lets the thread send the data that has been queued since the last wake up.
+        void wake();
+
+    private:
+        ITcpSocket& _listenSocket;
+        std::unique_ptr<ISocketPoller> _poller;
+        SpscQueue<std::unique_ptr<ITcpSocket>> _acceptedSockets;
+
+        // Held by the thread while it is servicing connections, but not while it waits.
+        std::mutex _mutex;
+        std::vector<Connection*> _connections;
+        // Held by the thread while it waits on the sockets of the connections, so that a connection that has just been
+        // removed is not destroyed while its socket is still being waited on.
+        std::mutex _waitMutex;
+
+        std::atomic<bool> _stopping = false;
+        std::thread _thread;
+
+        void run();
+        void acceptClients();
+    };
+} // namespace OpenRCT2::Network
+
+#endif // DISABLE_NETWORK
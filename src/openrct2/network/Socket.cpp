@@ -11,6 +11,7 @@
 
     #include "../Diagnostic.h"
 
+    #include <algorithm>
     #include <atomic>
     #include <chrono>
     #include <cmath>
@@ -18,6 +19,7 @@
     #include <future>
     #include <string>
     #include <thread>
+    #include <vector>
 
 // clang-format off
 // MSVC: include <math.h> here otherwise PI gets defined twice
@@ -54,10 +56,12 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/select.h>
     #include <sys/socket.h>
     #include <sys/time.h>
+    #include <sys/uio.h>
     #include <unistd.h>
 
     using SOCKET = int32_t;
@@ -80,6 +84,8 @@
 
     #include "Socket.h"
 
+    #include <sfl/small_vector.hpp>
+
 namespace OpenRCT2::Network
 {
     constexpr auto kConnectTimeout = std::chrono::milliseconds(3000);
@@ -298,6 +304,11 @@ namespace OpenRCT2::Network
             return _error.empty() ? nullptr : _error.c_str();
         }
 
+        SOCKET GetSocket() const noexcept
+        {
+            return _socket;
+        }
+
         void SetNoDelay(bool noDelay) override
         {
             if (_socket != INVALID_SOCKET)
@@ -581,6 +592,47 @@ namespace OpenRCT2::Network
             return totalSent;
         }
 
+        size_t SendBuffers(std::span<const std::span<const uint8_t>> buffers) override
+        {
+            if (_status != SocketStatus::connected)
+            {
+                throw std::runtime_error("Socket not connected.");
+            }
+
+    #ifdef _WIN32
+            sfl::small_vector<WSABUF, 64> wsaBuffers;
+            for (const auto& buffer : buffers)
+            {
+                auto* data = const_cast<CHAR*>(reinterpret_cast<const CHAR*>(buffer.data()));
+                wsaBuffers.push_back({ static_cast<ULONG>(buffer.size()), data });
+            }
+
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, wsaBuffers.data(), static_cast<DWORD>(wsaBuffers.size()), &sentBytes, 0, nullptr, nullptr)
+                == SOCKET_ERROR)
+            {
+                return 0;
+            }
+            return sentBytes;
+    #else
+            sfl::small_vector<iovec, 64> ioBuffers;
+            for (const auto& buffer : buffers)
+            {
+                ioBuffers.push_back({ const_cast<uint8_t*>(buffer.data()), buffer.size() });
+            }
+
+            msghdr message{};
+            message.msg_iov = ioBuffers.data();
+            message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(ioBuffers.size());
+            const auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return 0;
+            }
+            return static_cast<size_t>(sentBytes);
+    #endif
+        }
+
         ReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
         {
             if (_status != SocketStatus::connected)
@@ -869,6 +921,125 @@ namespace OpenRCT2::Network
         }
     };
 
+    class SocketPoller final : public ISocketPoller, protected Socket
+    {
+    private:
+        // Used when no wake up socket could be created, so that a wake up is not missed for longer than this.
+        static constexpr auto kFallbackTimeout = std::chrono::milliseconds(5);
+        // Used while there are sockets that can not be waited on, so that the caller keeps checking them without spinning.
+        static constexpr auto kUnpolledTimeout = std::chrono::milliseconds(1);
+
+        // A UDP socket connected to itself on the loopback interface, sending to it interrupts the wait. A pipe would do
+        // on other platforms but can not be polled together with sockets on Windows.
+        SOCKET _wakeSocket = INVALID_SOCKET;
+        std::vector<pollfd> _fds;
+        std::vector<size_t> _fdEntries;
+
+    public:
+        SocketPoller()
+        {
+            _wakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (_wakeSocket == INVALID_SOCKET)
+            {
+                LOG_WARNING("Unable to create wake up socket: %d", LAST_SOCKET_ERROR());
+                return;
+            }
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t addressLength = sizeof(address);
+            if (bind(_wakeSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0
+                || getsockname(_wakeSocket, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0
+                || connect(_wakeSocket, reinterpret_cast<sockaddr*>(&address), addressLength) != 0
+                || !SetNonBlocking(_wakeSocket, true))
+            {
+                LOG_WARNING("Unable to set up wake up socket: %d", LAST_SOCKET_ERROR());
+                closesocket(_wakeSocket);
+                _wakeSocket = INVALID_SOCKET;
+            }
+        }
+
+        ~SocketPoller() override
+        {
+            if (_wakeSocket != INVALID_SOCKET)
+            {
+                closesocket(_wakeSocket);
+            }
+        }
+
+        void Wait(std::vector<SocketPollEntry>& entries, std::chrono::milliseconds timeout) override
+        {
+            _fds.clear();
+            _fdEntries.clear();
+            if (_wakeSocket != INVALID_SOCKET)
+            {
+                _fds.push_back({ _wakeSocket, POLLIN, 0 });
+            }
+            else
+            {
+                timeout = std::min<std::chrono::milliseconds>(timeout, kFallbackTimeout);
+            }
+
+            for (size_t i = 0; i < entries.size(); i++)
+            {
+                auto& entry = entries[i];
+                auto* tcpSocket = dynamic_cast<TcpSocket*>(entry.socket);
+                const auto handle = tcpSocket != nullptr ? tcpSocket->GetSocket() : INVALID_SOCKET;
+                if (handle == INVALID_SOCKET)
+                {
+                    // Nothing to wait for, let the caller find out what the socket has to offer.
+                    entry.readable = true;
+                    entry.writable = entry.wantWrite;
+                    timeout = std::min<std::chrono::milliseconds>(timeout, kUnpolledTimeout);
+                    continue;
+                }
+
+                entry.readable = false;
+                entry.writable = false;
+                _fds.push_back({ handle, static_cast<short>(entry.wantWrite ? POLLIN | POLLOUT : POLLIN), 0 });
+                _fdEntries.push_back(i);
+            }
+
+    #ifdef _WIN32
+            const auto result = WSAPoll(_fds.data(), static_cast<ULONG>(_fds.size()), static_cast<INT>(timeout.count()));
+    #else
+            const auto result = poll(_fds.data(), static_cast<nfds_t>(_fds.size()), static_cast<int>(timeout.count()));
+    #endif
+            if (result <= 0)
+            {
+                return;
+            }
+
+            const size_t firstSocket = _wakeSocket != INVALID_SOCKET ? 1 : 0;
+            if (firstSocket != 0 && _fds[0].revents != 0)
+            {
+                char buffer[64];
+                while (recv(_wakeSocket, buffer, sizeof(buffer), 0) > 0)
+                {
+                }
+            }
+
+            for (size_t i = firstSocket; i < _fds.size(); i++)
+            {
+                const auto revents = _fds[i].revents;
+                auto& entry = entries[_fdEntries[i - firstSocket]];
+                entry.readable = (revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL)) != 0;
+                entry.writable = (revents & POLLOUT) != 0;
+            }
+        }
+
+        void Wake() override
+        {
+            if (_wakeSocket != INVALID_SOCKET)
+            {
+                // If the send fails the socket buffer is full of wake ups already.
+                const char signal = 0;
+                send(_wakeSocket, &signal, sizeof(signal), FLAG_NO_PIPE);
+            }
+        }
+    };
+
     std::unique_ptr<ITcpSocket> CreateTcpSocket()
     {
         InitialiseWSA();
@@ -881,6 +1052,12 @@ namespace OpenRCT2::Network
         return std::make_unique<UdpSocket>();
     }
 
+    std::unique_ptr<ISocketPoller> CreateSocketPoller()
+    {
+        InitialiseWSA();
+        return std::make_unique<SocketPoller>();
+    }
+
     #ifdef _WIN32
     static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
     {
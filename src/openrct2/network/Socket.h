@@ -11,7 +11,9 @@
 
 #include "../core/Endianness.h"
 
+#include <chrono>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -70,6 +72,22 @@ namespace OpenRCT2::Network
         virtual size_t SendData(const void* buffer, size_t size) = 0;
         virtual ReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) = 0;
 
+        // Sends the buffers one after the other with as few writes as possible, returns the number of bytes sent.
+        virtual size_t SendBuffers(std::span<const std::span<const uint8_t>> buffers)
+        {
+            size_t totalSent = 0;
+            for (const auto& buffer : buffers)
+            {
+                const auto sentBytes = SendData(buffer.data(), buffer.size());
+                totalSent += sentBytes;
+                if (sentBytes < buffer.size())
+                {
+                    break;
+                }
+            }
+            return totalSent;
+        }
+
         virtual void SetNoDelay(bool noDelay) = 0;
 
         virtual void Finish() = 0;
@@ -101,8 +119,29 @@ namespace OpenRCT2::Network
         virtual void Close() = 0;
     };
 
+    struct SocketPollEntry
+    {
+        ITcpSocket* socket{};
+        bool wantWrite{};
+        // Set by the poller, errors and hang ups are reported as readable so that the next read picks them up.
+        bool readable{};
+        bool writable{};
+    };
+
+    /**
+     * Waits for activity on a set of TCP sockets, the wait can be interrupted from another thread.
+     */
+    struct ISocketPoller
+    {
+        virtual ~ISocketPoller() = default;
+
+        virtual void Wait(std::vector<SocketPollEntry>& entries, std::chrono::milliseconds timeout) = 0;
+        virtual void Wake() = 0;
+    };
+
     [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
     [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
+    [[nodiscard]] std::unique_ptr<ISocketPoller> CreateSocketPoller();
     [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 } // namespace OpenRCT2::Network
 
@@ -18,25 +18,80 @@
 #include "../core/FileScanner.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/Image.h"
 #include "../drawing/ImageImporter.h"
 #include "Object.h"
 #include "ObjectFactory.h"
 
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace OpenRCT2
 {
     static thread_local std::map<u8string, std::unique_ptr<Object>> _objDataCache = {};
 
+    /**
+     * Reads the size of a PNG image from its header, which follows the signature, without decoding it.
+     */
+    static std::optional<ScreenSize> ReadPngSize(const std::vector<uint8_t>& data)
+    {
+        static constexpr uint8_t kSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        if (data.size() < 24 || std::memcmp(data.data(), kSignature, sizeof(kSignature)) != 0
+            || std::memcmp(&data[12], "IHDR", 4) != 0)
+        {
+            return std::nullopt;
+        }
+
+        const auto readBigEndian = [&data](size_t offset) {
+            return static_cast<int32_t>(
+                (data[offset] << 24) | (data[offset + 1] << 16) | (data[offset + 2] << 8) | data[offset + 3]);
+        };
+        return ScreenSize(readBigEndian(16), readBigEndian(20));
+    }
+
+    struct ImageTable::ImageSource
+    {
+        std::string path;
+        ImageFormat format{};
+        std::vector<uint8_t> data;
+        // Only set if the size could not be read from the header, in which case the image is decoded straight away.
+        std::optional<Image> image;
+        std::optional<ScreenSize> size;
+
+        ImageSource(std::string sourcePath, ImageFormat sourceFormat, std::vector<uint8_t>&& sourceData)
+            : path(std::move(sourcePath))
+            , format(sourceFormat)
+            , data(std::move(sourceData))
+        {
+            size = ReadPngSize(data);
+            if (!size.has_value())
+            {
+                image = Decode();
+                data = {};
+            }
+        }
+
+        Image Decode() const
+        {
+            return Imaging::ReadFromBuffer(data, format);
+        }
+    };
+
     struct ImageTable::RequiredImage
     {
         G1Element g1{};
         std::unique_ptr<RequiredImage> next_zoom;
+        // Set for images which are only decoded once they are drawn, g1 has no data in that case.
+        std::shared_ptr<const ImageSource> source;
+        Drawing::ImageImportMeta meta;
 
         bool HasData() const
         {
@@ -83,6 +138,127 @@ namespace OpenRCT2
         }
     };
 
+    class ImageTable::DeferredImages final : public Drawing::IDeferredImageSource
+    {
+    private:
+        struct Entry
+        {
+            std::shared_ptr<const ImageSource> source;
+            Drawing::ImageImportMeta meta;
+        };
+        std::unordered_map<uint32_t, Entry> _entries;
+
+        // The most recently decoded source, objects tend to draw several images taken from the same file in a row.
+        mutable std::mutex _mutex;
+        mutable std::shared_ptr<const ImageSource> _decodedSource;
+        mutable std::shared_ptr<const Image> _decodedImage;
+
+    public:
+        void Add(uint32_t index, const RequiredImage& image)
+        {
+            _entries[index] = { image.source, image.meta };
+        }
+
+        [[nodiscard]] bool IsDeferred(uint32_t index) const override
+        {
+            return _entries.contains(index);
+        }
+
+        [[nodiscard]] std::vector<uint8_t> LoadImage(uint32_t index) const override
+        {
+            auto it = _entries.find(index);
+            if (it == _entries.end())
+                return {};
+
+            const auto& entry = it->second;
+            try
+            {
+                return Import(*Decode(entry.source), entry);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Unable to load image '%s': %s", entry.source->path.c_str(), e.what());
+                return {};
+            }
+        }
+
+        /**
+         * Loads every deferred image of a table with the given number of images. Each source is only decoded once, and
+         * the sources are decoded in parallel.
+         */
+        [[nodiscard]] std::vector<std::vector<uint8_t>> LoadAll(uint32_t count) const
+        {
+            std::unordered_map<std::shared_ptr<const ImageSource>, std::vector<uint32_t>> indicesBySource;
+            for (const auto& [index, entry] : _entries)
+            {
+                indicesBySource[entry.source].push_back(index);
+            }
+
+            std::vector<std::vector<uint8_t>> result(count);
+            JobPool jobPool;
+            for (const auto& [source, indices] : indicesBySource)
+            {
+                jobPool.AddTask([this, &source, &indices, &result] {
+                    Image image;
+                    try
+                    {
+                        image = source->Decode();
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_WARNING("Unable to load image '%s': %s", source->path.c_str(), e.what());
+                        return;
+                    }
+
+                    for (auto index : indices)
+                    {
+                        try
+                        {
+                            result[index] = Import(image, _entries.at(index));
+                        }
+                        catch (const std::exception& e)
+                        {
+                            LOG_WARNING("Unable to load image '%s': %s", source->path.c_str(), e.what());
+                        }
+                    }
+                });
+            }
+            jobPool.Join();
+            return result;
+        }
+
+        void ReleaseCaches() const override
+        {
+            std::lock_guard lock(_mutex);
+            _decodedSource = nullptr;
+            _decodedImage = nullptr;
+        }
+
+    private:
+        static std::vector<uint8_t> Import(const Image& image, const Entry& entry)
+        {
+            auto meta = entry.meta;
+            Drawing::ImageImporter importer;
+            return importer.Import(image, meta).Buffer;
+        }
+
+        std::shared_ptr<const Image> Decode(const std::shared_ptr<const ImageSource>& source) const
+        {
+            {
+                std::lock_guard lock(_mutex);
+                if (_decodedSource == source)
+                    return _decodedImage;
+            }
+
+            auto image = std::make_shared<const Image>(source->Decode());
+
+            std::lock_guard lock(_mutex);
+            _decodedSource = source;
+            _decodedImage = image;
+            return image;
+        }
+    };
+
     std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, std::string s)
     {
         std::vector<std::unique_ptr<RequiredImage>> result;
@@ -170,14 +346,9 @@ namespace OpenRCT2
         {
             try
             {
-                auto imageData = context->GetData(s);
-                auto image = Imaging::ReadFromBuffer(imageData);
+                auto source = std::make_shared<const ImageSource>(s, ImageFormat::automatic, context->GetData(s));
                 auto meta = Drawing::ImageImportMeta{};
-
-                Drawing::ImageImporter importer;
-                auto importResult = importer.Import(image, meta);
-
-                result.push_back(std::make_unique<RequiredImage>(importResult.Element));
+                result.push_back(ImportImage(source, meta));
             }
             catch (const std::exception& e)
             {
@@ -190,7 +361,7 @@ namespace OpenRCT2
     }
 
     std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(
-        IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el)
+        IReadObjectContext* context, std::vector<std::shared_ptr<const ImageSource>>& imageSources, json_t& el)
     {
         Guard::Assert(el.is_object(), "ImageTable::ParseImages expects parameter el to be object");
 
@@ -202,17 +373,12 @@ namespace OpenRCT2
         {
             auto itSource = std::find_if(
                 imageSources.begin(), imageSources.end(),
-                [&path](const std::pair<std::string, Image>& item) { return item.first == path; });
+                [&path](const std::shared_ptr<const ImageSource>& item) { return item->path == path; });
             if (itSource == imageSources.end())
             {
                 throw std::runtime_error("Unable to find image in image source list.");
             }
-            auto& image = itSource->second;
-
-            Drawing::ImageImporter importer;
-            auto importResult = importer.Import(image, meta);
-            auto g1element = importResult.Element;
-            result.push_back(std::make_unique<RequiredImage>(g1element));
+            result.push_back(ImportImage(*itSource, meta));
         }
         catch (const std::exception& e)
         {
@@ -223,6 +389,35 @@ namespace OpenRCT2
         return result;
     }
 
+    std::unique_ptr<ImageTable::RequiredImage> ImageTable::ImportImage(
+        const std::shared_ptr<const ImageSource>& source, Drawing::ImageImportMeta& meta)
+    {
+        // Images which would fail to import, or whose palette does not match the source, are imported straight away so
+        // that the error is reported while loading the object.
+        const bool isPaletteValid = meta.palette != Drawing::Palette::KeepIndices || source->format == ImageFormat::png;
+        if (!source->image.has_value() && isPaletteValid)
+        {
+            if (meta.srcSize.width == 0)
+                meta.srcSize.width = source->size->width;
+            if (meta.srcSize.height == 0)
+                meta.srcSize.height = source->size->height;
+
+            if (meta.srcSize.width > 0 && meta.srcSize.width <= 256 && meta.srcSize.height > 0
+                && meta.srcSize.height <= 256)
+            {
+                auto result = std::make_unique<RequiredImage>();
+                result->g1 = Drawing::ImageImporter::CreateElement(meta);
+                result->source = source;
+                result->meta = meta;
+                return result;
+            }
+        }
+
+        Drawing::ImageImporter importer;
+        auto importResult = importer.Import(source->image.has_value() ? *source->image : source->Decode(), meta);
+        return std::make_unique<RequiredImage>(importResult.Element);
+    }
+
     std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadImageArchiveImages(
         IReadObjectContext* context, const std::string& path, const std::vector<int32_t>& range)
     {
@@ -499,25 +694,24 @@ namespace OpenRCT2
         }
     }
 
-    std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObjectContext* context, json_t& jsonImages)
+    std::vector<std::shared_ptr<const ImageTable::ImageSource>> ImageTable::GetImageSources(
+        IReadObjectContext* context, json_t& jsonImages)
     {
-        std::vector<std::pair<std::string, Image>> result;
+        std::vector<std::shared_ptr<const ImageSource>> result;
         for (auto& jsonImage : jsonImages)
         {
             if (jsonImage.is_object() && jsonImage.contains("path"))
             {
                 auto path = Json::GetString(jsonImage["path"]);
                 auto keepPalette = Json::GetString(jsonImage["palette"]) == "keep";
-                auto itSource = std::find_if(result.begin(), result.end(), [&path](const std::pair<std::string, Image>& item) {
-                    return item.first == path;
-                });
+                auto itSource = std::find_if(
+                    result.begin(), result.end(),
+                    [&path](const std::shared_ptr<const ImageSource>& item) { return item->path == path; });
                 if (itSource == result.end())
                 {
                     auto imageData = context->GetData(path);
                     auto imageFormat = keepPalette ? ImageFormat::png : ImageFormat::png32;
-                    auto image = Imaging::ReadFromBuffer(imageData, imageFormat);
-                    auto pair = std::make_pair<std::string, Image>(std::move(path), std::move(image));
-                    result.push_back(std::move(pair));
+                    result.push_back(std::make_shared<const ImageSource>(std::move(path), imageFormat, std::move(imageData)));
                 }
             }
         }
@@ -591,8 +785,14 @@ namespace OpenRCT2
             auto imagesStartIndex = GetCount();
             for (const auto& img : allImages)
             {
-                const auto& g1 = img->g1;
-                AddImage(&g1);
+                if (img->source != nullptr)
+                {
+                    AddDeferredImage(*img);
+                }
+                else
+                {
+                    AddImage(&img->g1);
+                }
             }
 
             // Add all the zoom images at the very end of the image table.
@@ -644,6 +844,44 @@ namespace OpenRCT2
         _entries.push_back(std::move(newg1));
     }
 
+    void ImageTable::AddDeferredImage(const RequiredImage& image)
+    {
+        if (_deferredImages == nullptr)
+        {
+            _deferredImages = std::make_shared<DeferredImages>();
+        }
+        _deferredImages->Add(GetCount(), image);
+        _entries.push_back(image.g1);
+    }
+
+    void ImageTable::LoadDeferredImages()
+    {
+        if (_deferredImages == nullptr)
+            return;
+
+        auto images = _deferredImages->LoadAll(GetCount());
+        for (uint32_t i = 0; i < GetCount(); i++)
+        {
+            if (!_deferredImages->IsDeferred(i))
+                continue;
+
+            const auto& data = images[i];
+            if (data.empty())
+            {
+                _entries[i] = {};
+                continue;
+            }
+            _entries[i].offset = new uint8_t[data.size()];
+            std::copy(data.begin(), data.end(), _entries[i].offset);
+        }
+        _deferredImages = nullptr;
+    }
+
+    std::shared_ptr<const Drawing::IDeferredImageSource> ImageTable::GetDeferredImages() const
+    {
+        return _deferredImages;
+    }
+
     void ImageTable::addPalette(const G1Palette& g1)
     {
         Guard::Assert(g1.flags.has(G1Flag::isPalette));
@@ -17,6 +17,12 @@
 
 struct Image;
 
+namespace OpenRCT2::Drawing
+{
+    struct IDeferredImageSource;
+    struct ImageImportMeta;
+} // namespace OpenRCT2::Drawing
+
 namespace OpenRCT2
 {
     struct IReadObjectContext;
@@ -32,7 +38,17 @@ namespace OpenRCT2
          * Container for a G1 image, additional information and RAII. Used by ReadJson
          */
         struct RequiredImage;
-        [[nodiscard]] std::vector<std::pair<std::string, Image>> GetImageSources(
+        /**
+         * An image file read by ReadJson, which is only decoded once one of the images taken from it is drawn.
+         */
+        struct ImageSource;
+        /**
+         * The images of the table which have not been decoded yet.
+         */
+        class DeferredImages;
+        std::shared_ptr<DeferredImages> _deferredImages;
+
+        [[nodiscard]] std::vector<std::shared_ptr<const ImageSource>> GetImageSources(
             IReadObjectContext* context, json_t& jsonImages);
         [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(
             IReadObjectContext* context, std::string s);
@@ -40,7 +56,9 @@ namespace OpenRCT2
          * @note root is deliberately left non-const: json_t behaviour changes when const
          */
         [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(
-            IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el);
+            IReadObjectContext* context, std::vector<std::shared_ptr<const ImageSource>>& imageSources, json_t& el);
+        [[nodiscard]] static std::unique_ptr<ImageTable::RequiredImage> ImportImage(
+            const std::shared_ptr<const ImageSource>& source, Drawing::ImageImportMeta& meta);
         [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadObjectImages(
             IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
         [[nodiscard]] static std::vector<int32_t> ParseRange(std::string s);
@@ -67,7 +85,16 @@ namespace OpenRCT2
         {
             return static_cast<uint32_t>(_entries.size());
         }
+        /**
+         * Decodes all images which would otherwise only be decoded when they are first drawn, for reading the table
+         * directly rather than through the image list.
+         */
+        void LoadDeferredImages();
+        std::shared_ptr<const Drawing::IDeferredImageSource> GetDeferredImages() const;
         void AddImage(const G1Element* g1);
         void addPalette(const G1Palette& g1);
+
+    private:
+        void AddDeferredImage(const RequiredImage& image);
     };
 } // namespace OpenRCT2
@@ -218,7 +218,9 @@ namespace OpenRCT2
     {
         if (_baseImageId == kImageIndexUndefined)
         {
-            _baseImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+            const auto& imageTable = GetImageTable();
+            _baseImageId = GfxObjectAllocateImages(
+                imageTable.GetImages(), imageTable.GetCount(), imageTable.GetDeferredImages());
         }
         return _baseImageId;
     }
@@ -848,6 +848,34 @@ static ImageId PaintPSColourifyImage(const PaintStruct* ps, ImageId imageId, uin
     }
 }
 
+static Profiling::Counter _paintArenaBlockAllocations("Paint arena blocks allocated");
+static Profiling::Counter _paintArenaBlockReleases("Paint arena blocks released");
+static Profiling::Counter _paintArenaHighWaterMark("Paint arena high water mark (entries)");
+
+void PaintNodeStorage::allocateBlock()
+{
+    overflowBlocks.emplace_back(new PaintEntry[kBlockSize]);
+    _paintArenaBlockAllocations.add(1);
+}
+
+void PaintNodeStorage::clear()
+{
+    _paintArenaHighWaterMark.updateMax(used);
+
+    // Keep enough overflow blocks for the larger of the last two frames. Sessions are not handed back to the same
+    // column every frame, so sizing from only the last frame would free and reallocate blocks as sessions swap columns.
+    const size_t highWaterMark = std::max(used, previousUsed);
+    const size_t blocksToKeep = highWaterMark > kBlockSize ? (highWaterMark - 1) / kBlockSize : 0;
+    if (overflowBlocks.size() > blocksToKeep)
+    {
+        _paintArenaBlockReleases.add(overflowBlocks.size() - blocksToKeep);
+        overflowBlocks.resize(blocksToKeep);
+    }
+
+    previousUsed = used;
+    used = 0;
+}
+
 PaintSession* PaintSessionAlloc(RenderTarget& rt, uint32_t viewFlags, uint8_t rotation)
 {
     return GetContext()->GetPainter()->CreateSession(rt, viewFlags, rotation);
@@ -19,11 +19,13 @@
 #include "Boundbox.h"
 #include "tile_element/Paint.Tunnel.h"
 
+#include <array>
+#include <memory>
 #include <mutex>
 #include <optional>
-#include <sfl/segmented_vector.hpp>
 #include <sfl/static_vector.hpp>
 #include <thread>
+#include <vector>
 
 enum class ViewportInteractionItem : uint8_t;
 
@@ -166,34 +168,47 @@ struct PaintSessionCore
     ViewportInteractionItem InteractionType;
 };
 
+// Bump arena for the paint entries of a session. Overflow blocks are kept when the session is released, so a session
+// that is reused for a busy column next frame does not have to allocate again and clearing is O(1).
 struct PaintNodeStorage
 {
-    // 1024 is typically enough to cover the column, after its full it will use dynamicPaintEntries.
-    sfl::static_vector<PaintEntry, 1024> fixedPaintEntries;
+    // 1024 is typically enough to cover the column, after its full it will use overflow blocks of the same size.
+    static constexpr size_t kBlockSize = 1024;
 
-    // This has to be wrapped in optional as it allocates memory before it is used.
-    std::optional<sfl::segmented_vector<PaintEntry, 256>> dynamicPaintEntries;
+    std::array<PaintEntry, kBlockSize> fixedPaintEntries;
+    std::vector<std::unique_ptr<PaintEntry[]>> overflowBlocks;
+
+    // Number of entries handed out since the last clear.
+    size_t used = 0;
+
+    // Number of entries that were used by the previous frame, used to decide how many overflow blocks to keep.
+    size_t previousUsed = 0;
 
     PaintEntry* allocate()
     {
-        if (!fixedPaintEntries.full())
+        if (used < kBlockSize)
         {
-            return &fixedPaintEntries.emplace_back();
+            return &fixedPaintEntries[used++];
         }
 
-        if (!dynamicPaintEntries.has_value())
+        const size_t overflowIndex = used - kBlockSize;
+        const size_t blockIndex = overflowIndex / kBlockSize;
+        if (blockIndex >= overflowBlocks.size())
         {
-            dynamicPaintEntries.emplace();
+            allocateBlock();
         }
 
-        return &dynamicPaintEntries->emplace_back();
+        used++;
+        return &overflowBlocks[blockIndex][overflowIndex % kBlockSize];
     }
 
-    void clear()
+    size_t size() const
     {
-        fixedPaintEntries.clear();
-        dynamicPaintEntries.reset();
+        return used;
     }
+
+    void allocateBlock();
+    void clear();
 };
 
 struct PaintSession : public PaintSessionCore
@@ -71,6 +71,7 @@
 #include <ctime>
 #include <numeric>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -155,6 +156,22 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Only reads the given chunks, for listing parks and scenarios without loading them. Import can not be used
+         * afterwards.
+         */
+        void LoadMetadata(IStream& stream, std::span<const ParkFileChunkType> chunks)
+        {
+            std::vector<uint32_t> chunkIds;
+            for (auto chunk : chunks)
+            {
+                chunkIds.push_back(EnumValue(chunk));
+            }
+            _os = std::make_unique<OrcaStream>(stream, chunkIds);
+            ThrowIfIncompatibleVersion();
+            RequiredObjects = {};
+        }
+
         void Import(GameState_t& gameState)
         {
             auto& os = *_os;
@@ -190,13 +207,16 @@ namespace OpenRCT2
             header.targetVersion = kParkFileCurrentVersion;
             header.minVersion = kParkFileMinVersion;
 
+            // The scenario and preview chunks are written first so they can be read without decompressing the map,
+            // see LoadMetadata.
             ReadWriteAuthoringChunk(os);
+            ReadWriteScenarioChunk(gameState, os);
+            ReadWritePreviewChunk(gameState, os);
             ReadWriteObjectsChunk(os);
             ReadWriteTilesChunk(gameState, os);
             ReadWriteBannersChunk(gameState, os);
             ReadWriteRidesChunk(gameState, os);
             ReadWriteEntitiesChunk(gameState, os);
-            ReadWriteScenarioChunk(gameState, os);
             ReadWriteGeneralChunk(gameState, os);
             ReadWriteParkChunk(gameState, os);
             ReadWriteClimateChunk(gameState, os);
@@ -206,7 +226,6 @@ namespace OpenRCT2
             ReadWriteCheatsChunk(gameState, os);
             ReadWriteRestrictedObjectsChunk(gameState, os);
             ReadWritePluginStorageChunk(gameState, os);
-            ReadWritePreviewChunk(gameState, os);
             ReadWritePackedObjectsChunk(os);
         }
 
@@ -2854,6 +2873,20 @@ public:
         GameFixSaveVars();
     }
 
+    void LoadScenarioMetadata(IStream* stream, [[maybe_unused]] const u8string& path = {}) override
+    {
+        static constexpr ParkFileChunkType kChunks[] = { ParkFileChunkType::scenario };
+        _parkFile = std::make_unique<ParkFile>();
+        _parkFile->LoadMetadata(*stream, kChunks);
+    }
+
+    void LoadParkPreview(IStream* stream) override
+    {
+        static constexpr ParkFileChunkType kChunks[] = { ParkFileChunkType::preview };
+        _parkFile = std::make_unique<ParkFile>();
+        _parkFile->LoadMetadata(*stream, kChunks);
+    }
+
     bool PopulateIndexEntry(ScenarioIndexEntry* dst) override
     {
         *dst = _parkFile->ReadScenarioChunk();
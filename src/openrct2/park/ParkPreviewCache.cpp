@@ -0,0 +1,247 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkPreviewCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../FileClassifier.h"
+#include "../ParkImporter.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/FileStream.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "ParkPreview.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t kPreviewCacheMagic = 0x43565050; // PPVC
+static constexpr uint32_t kPreviewCacheVersion = 1;
+
+// Previews hold up to two images of 250x250 pixels, keep enough of them to page back and forth through a folder.
+static constexpr size_t kMaxRecentPreviews = 32;
+
+ParkPreviewCache::ParkPreviewCache(u8string directory, size_t maxCachedPreviews)
+    : _directory(std::move(directory))
+    , _maxCachedPreviews(maxCachedPreviews)
+{
+}
+
+std::shared_ptr<const ParkPreview> ParkPreviewCache::TryGetRecent(const u8string& path)
+{
+    const auto size = File::GetSize(path);
+    const auto lastModified = File::GetLastModified(path);
+
+    std::lock_guard lock(_mutex);
+    return FindRecent(path, size, lastModified);
+}
+
+std::shared_ptr<const ParkPreview> ParkPreviewCache::Get(const u8string& path)
+{
+    const auto size = File::GetSize(path);
+    const auto lastModified = File::GetLastModified(path);
+    const auto cachePath = GetCachePath(path);
+
+    {
+        // The cache files are only accessed while holding the lock, so that a file is never read while another thread
+        // is still writing it.
+        std::lock_guard lock(_mutex);
+        if (auto preview = FindRecent(path, size, lastModified); preview != nullptr)
+        {
+            return preview;
+        }
+        if (auto preview = TryRead(cachePath, path, size, lastModified); preview != nullptr)
+        {
+            AddRecent(path, size, lastModified, preview);
+            return preview;
+        }
+    }
+
+    std::shared_ptr<ParkPreview> preview;
+    try
+    {
+        auto fs = FileStream(path, FileMode::open);
+
+        ClassifiedFileInfo info;
+        if (!TryClassifyFile(&fs, &info) || info.Type != FileType::park)
+            return nullptr;
+
+        auto& objectRepository = GetContext()->GetObjectRepository();
+        auto parkImporter = ParkImporter::CreateParkFile(objectRepository);
+        parkImporter->LoadParkPreview(&fs);
+        preview = std::make_shared<ParkPreview>(parkImporter->GetParkPreview());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Could not get preview for \"%s\" due to %s", path.c_str(), e.what());
+        return nullptr;
+    }
+
+    std::lock_guard lock(_mutex);
+    Write(cachePath, path, size, lastModified, *preview);
+    AddRecent(path, size, lastModified, preview);
+    return preview;
+}
+
+std::shared_ptr<const ParkPreview> ParkPreviewCache::FindRecent(const u8string& path, uint64_t size, uint64_t lastModified)
+{
+    auto it = std::find_if(_recent.begin(), _recent.end(), [&path](const RecentEntry& entry) { return entry.path == path; });
+    if (it == _recent.end())
+    {
+        return nullptr;
+    }
+    if (it->size != size || it->lastModified != lastModified)
+    {
+        _recent.erase(it);
+        return nullptr;
+    }
+
+    _recent.splice(_recent.begin(), _recent, it);
+    return it->preview;
+}
+
+void ParkPreviewCache::AddRecent(
+    const u8string& path, uint64_t size, uint64_t lastModified, std::shared_ptr<const ParkPreview> preview)
+{
+    // Another thread may have added the same park in the meantime.
+    std::erase_if(_recent, [&path](const RecentEntry& entry) { return entry.path == path; });
+    _recent.push_front({ path, size, lastModified, std::move(preview) });
+    if (_recent.size() > kMaxRecentPreviews)
+    {
+        _recent.pop_back();
+    }
+}
+
+u8string ParkPreviewCache::GetCachePath(const u8string& path) const
+{
+    // Each park gets one entry, which is replaced when the park changes.
+    auto hash = Crypt::FNV1a(path.data(), path.size());
+    uint64_t key;
+    std::memcpy(&key, hash.data(), sizeof(key));
+    return Path::Combine(_directory, String::stdFormat("%016" PRIx64 ".preview", key));
+}
+
+std::shared_ptr<const ParkPreview> ParkPreviewCache::TryRead(
+    const u8string& cachePath, const u8string& path, uint64_t size, uint64_t lastModified) const
+{
+    if (!File::Exists(cachePath))
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        FileStream fs(cachePath, FileMode::open);
+        if (fs.ReadValue<uint32_t>() != kPreviewCacheMagic || fs.ReadValue<uint32_t>() != kPreviewCacheVersion)
+            return nullptr;
+
+        if (fs.ReadString() != path || fs.ReadValue<uint64_t>() != size || fs.ReadValue<uint64_t>() != lastModified)
+            return nullptr;
+
+        auto preview = std::make_shared<ParkPreview>();
+        preview->parkName = fs.ReadString();
+        preview->parkRating = fs.ReadValue<uint16_t>();
+        preview->year = fs.ReadValue<int32_t>();
+        preview->month = fs.ReadValue<int32_t>();
+        preview->day = fs.ReadValue<int32_t>();
+        preview->parkUsesMoney = fs.ReadValue<uint8_t>() != 0;
+        preview->cash = fs.ReadValue<money64>();
+        preview->numRides = fs.ReadValue<uint16_t>();
+        preview->numGuests = fs.ReadValue<uint16_t>();
+
+        const auto numImages = fs.ReadValue<uint8_t>();
+        preview->images.resize(numImages);
+        for (auto& image : preview->images)
+        {
+            image.type = fs.ReadValue<PreviewImageType>();
+            image.width = fs.ReadValue<uint8_t>();
+            image.height = fs.ReadValue<uint8_t>();
+            if (image.width > kMaxPreviewImageSize || image.height > kMaxPreviewImageSize)
+                return nullptr;
+
+            // Only the pixels that are used are stored, instead of the whole buffer.
+            fs.Read(image.pixels, image.width * image.height);
+        }
+        return preview;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read park preview cache '%s': %s", cachePath.c_str(), e.what());
+        return nullptr;
+    }
+}
+
+void ParkPreviewCache::Write(
+    const u8string& cachePath, const u8string& path, uint64_t size, uint64_t lastModified, const ParkPreview& preview)
+{
+    const bool isNewEntry = !File::Exists(cachePath);
+
+    // Written to a temporary file first, so that another instance of the game never reads a partially written preview.
+    const auto tempPath = cachePath + u8".tmp";
+    try
+    {
+        Path::CreateDirectory(_directory);
+        {
+            FileStream fs(tempPath, FileMode::write);
+            fs.WriteValue<uint32_t>(kPreviewCacheMagic);
+            fs.WriteValue<uint32_t>(kPreviewCacheVersion);
+            fs.WriteString(path);
+            fs.WriteValue<uint64_t>(size);
+            fs.WriteValue<uint64_t>(lastModified);
+
+            fs.WriteString(preview.parkName);
+            fs.WriteValue<uint16_t>(preview.parkRating);
+            fs.WriteValue<int32_t>(preview.year);
+            fs.WriteValue<int32_t>(preview.month);
+            fs.WriteValue<int32_t>(preview.day);
+            fs.WriteValue<uint8_t>(preview.parkUsesMoney ? 1 : 0);
+            fs.WriteValue<money64>(preview.cash);
+            fs.WriteValue<uint16_t>(preview.numRides);
+            fs.WriteValue<uint16_t>(preview.numGuests);
+
+            fs.WriteValue<uint8_t>(static_cast<uint8_t>(preview.images.size()));
+            for (const auto& image : preview.images)
+            {
+                fs.WriteValue<PreviewImageType>(image.type);
+                fs.WriteValue<uint8_t>(image.width);
+                fs.WriteValue<uint8_t>(image.height);
+                fs.Write(image.pixels, image.width * image.height);
+            }
+        }
+        if (!File::Move(tempPath, cachePath))
+        {
+            LOG_WARNING("Unable to replace park preview cache '%s'", cachePath.c_str());
+            File::Delete(tempPath);
+            return;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to write park preview cache '%s': %s", cachePath.c_str(), e.what());
+        File::Delete(tempPath);
+        return;
+    }
+
+    // The directory is only scanned once per session and when it is full, not on every write.
+    if (!_numCachedPreviews.has_value() || (isNewEntry && ++*_numCachedPreviews > _maxCachedPreviews))
+    {
+        Prune(cachePath);
+    }
+}
+
+void ParkPreviewCache::Prune(const u8string& keepPath)
+{
+    _numCachedPreviews = File::DeleteOldestFiles(_directory, u8"*.preview", _maxCachedPreviews, keepPath);
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/StringTypes.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace OpenRCT2
+{
+    struct ParkPreview;
+
+    /**
+     * Keeps the previews of park files shown by the file browsers, so that they do not need to be read from the park again
+     * each time a file is selected. Previews are kept in memory for the most recently used parks and in the cache
+     * directory for all others, and are read again when the size or modification time of the park changes. The oldest
+     * previews are removed from the cache directory when it holds more than the given number of them.
+     */
+    class ParkPreviewCache
+    {
+    private:
+        struct RecentEntry
+        {
+            u8string path;
+            uint64_t size{};
+            uint64_t lastModified{};
+            std::shared_ptr<const ParkPreview> preview;
+        };
+
+        u8string _directory;
+        size_t _maxCachedPreviews;
+        std::mutex _mutex;
+        std::list<RecentEntry> _recent;
+        // Unknown until the cache directory is first written to.
+        std::optional<size_t> _numCachedPreviews;
+
+    public:
+        static constexpr size_t kDefaultMaxCachedPreviews = 256;
+
+        explicit ParkPreviewCache(u8string directory, size_t maxCachedPreviews = kDefaultMaxCachedPreviews);
+
+        /**
+         * Returns the preview of the given park if it is in memory, without accessing the park or the cache directory.
+         * Returns nullptr otherwise.
+         */
+        std::shared_ptr<const ParkPreview> TryGetRecent(const u8string& path);
+
+        /**
+         * Returns the preview of the given park, reading it from the park if it is not cached. Returns nullptr if the file
+         * is not a park file or can not be read. Can be called from any thread.
+         */
+        std::shared_ptr<const ParkPreview> Get(const u8string& path);
+
+    private:
+        std::shared_ptr<const ParkPreview> FindRecent(const u8string& path, uint64_t size, uint64_t lastModified);
+        void AddRecent(const u8string& path, uint64_t size, uint64_t lastModified, std::shared_ptr<const ParkPreview> preview);
+        u8string GetCachePath(const u8string& path) const;
+        std::shared_ptr<const ParkPreview> TryRead(
+            const u8string& cachePath, const u8string& path, uint64_t size, uint64_t lastModified) const;
+        void Write(
+            const u8string& cachePath, const u8string& path, uint64_t size, uint64_t lastModified, const ParkPreview& preview);
+        void Prune(const u8string& keepPath);
+    };
+} // namespace OpenRCT2
@@ -12,11 +12,16 @@
 #include "../core/Json.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cctype>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
+#include <limits>
+#include <memory>
 
 namespace OpenRCT2::Profiling
 {
@@ -43,6 +48,36 @@ namespace OpenRCT2::Profiling
         using Clock = std::chrono::high_resolution_clock;
         using TimePoint = Clock::time_point;
 
+        static constexpr size_t kFunctionsPerBlock = 256;
+        static constexpr size_t kMaxFunctionBlocks = 64;
+        static constexpr size_t kMaxEventsPerThread = 1u << 16;
+        static constexpr size_t kMaxCallGraphEdges = 1u << 13;
+
+        // Event ids above the function indices are used for the markers.
+        static constexpr uint32_t kFrameMarkerId = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t kTickMarkerId = kFrameMarkerId - 1;
+
+        // All the timing data is only written by the thread that owns it. Readers on other threads merge it, so the
+        // values are atomics to make the concurrent reads safe, but they are never updated with read-modify-write
+        // operations.
+        struct FunctionStats
+        {
+            std::atomic<uint64_t> CallCount{ 0 };
+            std::atomic<uint64_t> TotalTimeNs{ 0 };
+            std::atomic<uint64_t> MinTimeNs{ 0 };
+            std::atomic<uint64_t> MaxTimeNs{ 0 };
+
+            // Only used by the owning thread, to skip the call graph when it was linked to the same parent last time.
+            FunctionInternal* LastParent{ nullptr };
+        };
+
+        struct Event
+        {
+            std::atomic<uint64_t> StartNs{ 0 };
+            std::atomic<uint32_t> DurationNs{ 0 };
+            std::atomic<uint32_t> Id{ 0 };
+        };
+
         struct StackEntry
         {
             FunctionInternal* Parent;
@@ -50,119 +85,444 @@ namespace OpenRCT2::Profiling
             TimePoint EntryTime;
         };
 
-        static thread_local std::vector<StackEntry> _callStack;
+        struct ThreadData
+        {
+            uint32_t Id{};
+            std::string Name;
 
-        std::vector<Function*>& getRegistry()
+            // Data from before the last reset is ignored by readers until the owning thread clears it.
+            std::atomic<uint32_t> Generation{ 0 };
+            std::atomic<bool> Retired{ false };
+
+            std::array<std::atomic<FunctionStats*>, kMaxFunctionBlocks> Blocks{};
+
+            // Ring buffer of the most recent calls, published by EventCount.
+            std::unique_ptr<Event[]> Events = std::make_unique<Event[]>(kMaxEventsPerThread);
+            std::atomic<uint64_t> EventCount{ 0 };
+
+            std::vector<StackEntry> CallStack;
+
+            ThreadData() = default;
+            ThreadData(const ThreadData&) = delete;
+            ThreadData& operator=(const ThreadData&) = delete;
+
+            ~ThreadData()
+            {
+                for (auto& block : Blocks)
+                {
+                    delete[] block.load(std::memory_order_relaxed);
+                }
+            }
+
+            FunctionStats* getStats(uint32_t index) const
+            {
+                const auto blockIndex = index / kFunctionsPerBlock;
+                if (blockIndex >= kMaxFunctionBlocks)
+                    return nullptr;
+
+                auto* block = Blocks[blockIndex].load(std::memory_order_acquire);
+                return block != nullptr ? &block[index % kFunctionsPerBlock] : nullptr;
+            }
+
+            FunctionStats* getOrCreateStats(uint32_t index)
+            {
+                const auto blockIndex = index / kFunctionsPerBlock;
+                if (blockIndex >= kMaxFunctionBlocks)
+                    return nullptr;
+
+                auto* block = Blocks[blockIndex].load(std::memory_order_relaxed);
+                if (block == nullptr)
+                {
+                    block = new FunctionStats[kFunctionsPerBlock];
+                    Blocks[blockIndex].store(block, std::memory_order_release);
+                }
+                return &block[index % kFunctionsPerBlock];
+            }
+
+            void addEvent(uint64_t startNs, uint64_t durationNs, uint32_t id)
+            {
+                const auto count = EventCount.load(std::memory_order_relaxed);
+                auto& event = Events[count % kMaxEventsPerThread];
+                event.StartNs.store(startNs, std::memory_order_relaxed);
+                event.DurationNs.store(
+                    static_cast<uint32_t>(std::min<uint64_t>(durationNs, std::numeric_limits<uint32_t>::max())),
+                    std::memory_order_relaxed);
+                event.Id.store(id, std::memory_order_relaxed);
+                EventCount.store(count + 1, std::memory_order_release);
+            }
+
+            // Called by the owning thread after a reset.
+            void clear()
+            {
+                for (auto& block : Blocks)
+                {
+                    auto* stats = block.load(std::memory_order_relaxed);
+                    if (stats == nullptr)
+                        continue;
+
+                    for (size_t i = 0; i < kFunctionsPerBlock; i++)
+                    {
+                        stats[i].CallCount.store(0, std::memory_order_relaxed);
+                        stats[i].TotalTimeNs.store(0, std::memory_order_relaxed);
+                        stats[i].MinTimeNs.store(0, std::memory_order_relaxed);
+                        stats[i].MaxTimeNs.store(0, std::memory_order_relaxed);
+                        stats[i].LastParent = nullptr;
+                    }
+                }
+                EventCount.store(0, std::memory_order_relaxed);
+            }
+        };
+
+        struct RecordedEvent
         {
-            static std::vector<Function*> registry;
-            return registry;
-        }
+            uint64_t StartNs;
+            uint32_t DurationNs;
+            uint32_t Id;
+        };
 
-        std::mutex& getRegistryMutex()
+        static const TimePoint _epoch = Clock::now();
+        static std::atomic<uint32_t> _generation{ 1 };
+
+        // Lock free set of call graph edges, each stored as the parent and child indices plus one, so that zero marks an
+        // empty slot. Edges are only inserted the first time a thread sees them.
+        static std::array<std::atomic<uint64_t>, kMaxCallGraphEdges> _callGraphEdges{};
+
+        static std::mutex& getThreadsMutex()
         {
             static std::mutex mutex;
             return mutex;
         }
 
-        void registerFunction(FunctionInternal* func)
+        static std::vector<std::unique_ptr<ThreadData>>& getThreads()
         {
-            std::scoped_lock lock(getRegistryMutex());
-            getRegistry().push_back(func);
+            static std::vector<std::unique_ptr<ThreadData>> threads;
+            return threads;
         }
 
-        void functionEnter(FunctionInternal& func)
+        // Marks the data of a thread as retired when the thread exits, so that it can be released on the next reset.
+        struct ThreadDataOwner
         {
-            const auto entryTime = Clock::now();
-            func.CallCount.fetch_add(1, std::memory_order_relaxed);
+            ThreadData* Data{};
+            std::string Name;
 
-            FunctionInternal* parent = nullptr;
-            if (!_callStack.empty())
+            ~ThreadDataOwner()
             {
-                parent = _callStack.back().Func;
+                if (Data != nullptr)
+                {
+                    Data->Retired.store(true, std::memory_order_release);
+                }
             }
+        };
 
-            _callStack.push_back({ parent, &func, entryTime });
-        }
+        static thread_local ThreadDataOwner _threadData;
 
-        bool FunctionInternal::tryAddParent(FunctionInternal* parent)
+        static ThreadData& getThreadData()
         {
-            std::scoped_lock lock(Mutex);
-            if (std::find(Parents.begin(), Parents.end(), parent) == Parents.end())
+            auto* data = _threadData.Data;
+            if (data == nullptr)
             {
-                Parents.push_back(parent);
-                return true;
+                std::scoped_lock lock(getThreadsMutex());
+                auto& threads = getThreads();
+                auto newData = std::make_unique<ThreadData>();
+                newData->Id = threads.empty() ? 1 : threads.back()->Id + 1;
+                newData->Name = _threadData.Name;
+                data = newData.get();
+                threads.push_back(std::move(newData));
+                _threadData.Data = data;
             }
-            return false;
+
+            const auto generation = _generation.load(std::memory_order_acquire);
+            if (data->Generation.load(std::memory_order_relaxed) != generation)
+            {
+                data->clear();
+                data->Generation.store(generation, std::memory_order_release);
+            }
+            return *data;
         }
 
-        bool FunctionInternal::tryAddChild(FunctionInternal* child)
+        // Calls the given function for the data of each thread that was recorded since the last reset.
+        template<typename TFn>
+        static void forEachThread(TFn&& fn)
         {
-            std::scoped_lock lock(Mutex);
-            if (std::find(Children.begin(), Children.end(), child) == Children.end())
+            std::scoped_lock lock(getThreadsMutex());
+            const auto generation = _generation.load(std::memory_order_acquire);
+            for (const auto& data : getThreads())
             {
-                Children.push_back(child);
-                return true;
+                if (data->Generation.load(std::memory_order_acquire) == generation)
+                {
+                    fn(*data);
+                }
             }
-            return false;
         }
 
-        std::vector<double> FunctionInternal::getTimeSamples() const
+        // Copies the events of a thread that were not overwritten while they were read.
+        static std::vector<RecordedEvent> getEvents(const ThreadData& data)
         {
-            const size_t totalSamples = SampleIndex.load(std::memory_order_relaxed);
-            const size_t count = std::min(totalSamples, MaxSamplesSize);
-            std::vector<double> result;
-            result.reserve(count);
+            const auto end = data.EventCount.load(std::memory_order_acquire);
+            const auto begin = end > kMaxEventsPerThread ? end - kMaxEventsPerThread : 0;
 
-            const size_t startIdx = (totalSamples > MaxSamplesSize) ? (totalSamples % MaxSamplesSize) : 0;
-            for (size_t i = 0; i < count; ++i)
+            std::vector<RecordedEvent> result;
+            result.reserve(end - begin);
+            for (auto i = begin; i < end; i++)
             {
-                const size_t idx = (startIdx + i) % MaxSamplesSize;
-                result.push_back(static_cast<double>(Samples[idx].load(std::memory_order_relaxed)) / 1000.0);
+                const auto& event = data.Events[i % kMaxEventsPerThread];
+                result.push_back(
+                    { event.StartNs.load(std::memory_order_relaxed), event.DurationNs.load(std::memory_order_relaxed),
+                      event.Id.load(std::memory_order_relaxed) });
+            }
+
+            // The owning thread may have overwritten the oldest events in the meantime, and may be writing the next one.
+            const auto after = data.EventCount.load(std::memory_order_acquire);
+            const auto firstValid = after + 1 > kMaxEventsPerThread ? after + 1 - kMaxEventsPerThread : 0;
+            if (firstValid > begin)
+            {
+                result.erase(result.begin(), result.begin() + std::min<size_t>(firstValid - begin, result.size()));
             }
             return result;
         }
 
+        static uint64_t getTimeNs(TimePoint time)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time - _epoch).count());
+        }
+
+        static size_t getEdgeSlot(uint64_t key)
+        {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) % kMaxCallGraphEdges;
+        }
+
+        static void addCallGraphEdge(const FunctionInternal& parent, const FunctionInternal& child)
+        {
+            const auto key = (static_cast<uint64_t>(parent.Index + 1) << 32) | (child.Index + 1);
+            auto slot = getEdgeSlot(key);
+            for (size_t probe = 0; probe < kMaxCallGraphEdges; probe++)
+            {
+                auto& edge = _callGraphEdges[slot];
+                auto current = edge.load(std::memory_order_relaxed);
+                if (current == 0 && edge.compare_exchange_strong(current, key, std::memory_order_relaxed))
+                    return;
+                if (current == key)
+                    return;
+                slot = (slot + 1) % kMaxCallGraphEdges;
+            }
+            // The set is full, the edge is left out of the call graph.
+        }
+
+        template<typename TFn>
+        static void forEachCallGraphEdge(TFn&& fn)
+        {
+            for (const auto& edge : _callGraphEdges)
+            {
+                const auto key = edge.load(std::memory_order_relaxed);
+                if (key != 0)
+                {
+                    fn(static_cast<uint32_t>(key >> 32) - 1, static_cast<uint32_t>(key & 0xFFFFFFFF) - 1);
+                }
+            }
+        }
+
+        std::vector<Function*>& getRegistry()
+        {
+            static std::vector<Function*> registry;
+            return registry;
+        }
+
+        std::mutex& getRegistryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        void registerFunction(FunctionInternal* func)
+        {
+            std::scoped_lock lock(getRegistryMutex());
+            auto& registry = getRegistry();
+            func->Index = static_cast<uint32_t>(registry.size());
+            registry.push_back(func);
+        }
+
+        static std::vector<Counter*>& getCounterRegistry()
+        {
+            static std::vector<Counter*> registry;
+            return registry;
+        }
+
+        void functionEnter(FunctionInternal& func)
+        {
+            auto& data = getThreadData();
+
+            FunctionInternal* parent = nullptr;
+            if (!data.CallStack.empty())
+            {
+                parent = data.CallStack.back().Func;
+            }
+
+            data.CallStack.push_back({ parent, &func, Clock::now() });
+        }
+
         void functionExit(FunctionInternal& func)
         {
             const auto exitTime = Clock::now();
 
-            assert(!_callStack.empty() && "FunctionExit called without matching FunctionEnter");
+            auto& data = getThreadData();
+            assert(!data.CallStack.empty() && "FunctionExit called without matching FunctionEnter");
 
-            const auto& entry = _callStack.back();
+            const auto entry = data.CallStack.back();
+            data.CallStack.pop_back();
             assert(entry.Func == &func && "FunctionExit called for wrong function");
 
             const auto elapsed = exitTime - entry.EntryTime;
             const auto elapsedNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
 
-            // All timing updates are lock free
-            func.TotalTimeNs.fetch_add(elapsedNs, std::memory_order_relaxed);
-            func.updateMin(elapsedNs);
-            func.updateMax(elapsedNs);
+            data.addEvent(getTimeNs(entry.EntryTime), elapsedNs, func.Index);
+
+            auto* stats = data.getOrCreateStats(func.Index);
+            if (stats == nullptr)
+                return;
 
-            const size_t idx = func.SampleIndex.fetch_add(1, std::memory_order_relaxed) % MaxSamplesSize;
-            func.Samples[idx].store(elapsedNs, std::memory_order_relaxed);
+            stats->CallCount.store(stats->CallCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            stats->TotalTimeNs.store(stats->TotalTimeNs.load(std::memory_order_relaxed) + elapsedNs, std::memory_order_relaxed);
+            const auto minTime = stats->MinTimeNs.load(std::memory_order_relaxed);
+            if (minTime == 0 || elapsedNs < minTime)
+                stats->MinTimeNs.store(elapsedNs, std::memory_order_relaxed);
+            if (elapsedNs > stats->MaxTimeNs.load(std::memory_order_relaxed))
+                stats->MaxTimeNs.store(elapsedNs, std::memory_order_relaxed);
 
-            // Only take locks when discovering new relationships
-            if (entry.Parent != nullptr)
+            // Only touch the shared call graph when the parent differs from last time.
+            if (entry.Parent != nullptr && stats->LastParent != entry.Parent)
             {
-                // If this is the same parent as last time, skip lock
-                FunctionInternal* lastParent = func.LastParent.load(std::memory_order_relaxed);
-                if (lastParent != entry.Parent)
+                addCallGraphEdge(*entry.Parent, func);
+                stats->LastParent = entry.Parent;
+            }
+        }
+
+        uint64_t FunctionInternal::getCallCount() const noexcept
+        {
+            uint64_t result = 0;
+            forEachThread([&](const ThreadData& data) {
+                if (const auto* stats = data.getStats(Index))
+                    result += stats->CallCount.load(std::memory_order_relaxed);
+            });
+            return result;
+        }
+
+        double FunctionInternal::getTotalTime() const
+        {
+            uint64_t result = 0;
+            forEachThread([&](const ThreadData& data) {
+                if (const auto* stats = data.getStats(Index))
+                    result += stats->TotalTimeNs.load(std::memory_order_relaxed);
+            });
+            return static_cast<double>(result) / 1000.0;
+        }
+
+        double FunctionInternal::getMinTime() const
+        {
+            uint64_t result = 0;
+            forEachThread([&](const ThreadData& data) {
+                if (const auto* stats = data.getStats(Index))
                 {
-                    // Potentially new relationship so take locks and check
-                    if (func.tryAddParent(entry.Parent))
-                    {
-                        entry.Parent->tryAddChild(&func);
-                    }
-                    func.LastParent.store(entry.Parent, std::memory_order_relaxed);
+                    const auto value = stats->MinTimeNs.load(std::memory_order_relaxed);
+                    if (value != 0 && (result == 0 || value < result))
+                        result = value;
                 }
+            });
+            return static_cast<double>(result) / 1000.0;
+        }
+
+        double FunctionInternal::getMaxTime() const
+        {
+            uint64_t result = 0;
+            forEachThread([&](const ThreadData& data) {
+                if (const auto* stats = data.getStats(Index))
+                    result = std::max(result, stats->MaxTimeNs.load(std::memory_order_relaxed));
+            });
+            return static_cast<double>(result) / 1000.0;
+        }
+
+        std::vector<double> FunctionInternal::getTimeSamples() const
+        {
+            // The most recent calls from all threads, oldest first.
+            std::vector<RecordedEvent> events;
+            forEachThread([&](const ThreadData& data) {
+                for (const auto& event : getEvents(data))
+                {
+                    if (event.Id == Index)
+                        events.push_back(event);
+                }
+            });
+            std::sort(events.begin(), events.end(), [](const RecordedEvent& a, const RecordedEvent& b) {
+                return a.StartNs + a.DurationNs < b.StartNs + b.DurationNs;
+            });
+
+            const auto count = std::min(events.size(), MaxSamplesSize);
+            std::vector<double> result;
+            result.reserve(count);
+            for (auto it = events.end() - count; it != events.end(); ++it)
+            {
+                result.push_back(static_cast<double>(it->DurationNs) / 1000.0);
             }
+            return result;
+        }
 
-            _callStack.pop_back();
+        // Functions are only registered during static initialization, so the registry can be read without the lock.
+        std::vector<Function*> FunctionInternal::getParents() const
+        {
+            const auto& registry = getRegistry();
+            std::vector<Function*> result;
+            forEachCallGraphEdge([&](uint32_t parent, uint32_t child) {
+                if (child == Index && parent < registry.size())
+                    result.push_back(registry[parent]);
+            });
+            return result;
+        }
+
+        std::vector<Function*> FunctionInternal::getChildren() const
+        {
+            const auto& registry = getRegistry();
+            std::vector<Function*> result;
+            forEachCallGraphEdge([&](uint32_t parent, uint32_t child) {
+                if (parent == Index && child < registry.size())
+                    result.push_back(registry[child]);
+            });
+            return result;
         }
 
     } // namespace Detail
 
+    void addMarker(Marker marker)
+    {
+        if (!isEnabled())
+            return;
+
+        auto& data = Detail::getThreadData();
+        const auto id = marker == Marker::frame ? Detail::kFrameMarkerId : Detail::kTickMarkerId;
+        data.addEvent(Detail::getTimeNs(Detail::Clock::now()), 0, id);
+    }
+
+    void setThreadName(const char* name)
+    {
+        Detail::_threadData.Name = name;
+        if (Detail::_threadData.Data != nullptr)
+        {
+            std::scoped_lock lock(Detail::getThreadsMutex());
+            Detail::_threadData.Data->Name = name;
+        }
+    }
+
+    Counter::Counter(const char* name)
+        : _name(name)
+    {
+        std::scoped_lock lock(Detail::getRegistryMutex());
+        Detail::getCounterRegistry().push_back(this);
+    }
+
+    const std::vector<Counter*>& getCounters()
+    {
+        // Returns reference to static vector. Safe because counters are only registered during static initialization.
+        return Detail::getCounterRegistry();
+    }
+
     const std::vector<Function*>& getData()
     {
         // eturns reference to static vector. Safe because functions are only registered during static initialization.
@@ -171,29 +531,29 @@ namespace OpenRCT2::Profiling
 
     void resetData()
     {
-        std::scoped_lock lock(Detail::getRegistryMutex());
-
-        for (auto* func : Detail::getRegistry())
+        // Cleared before the generation changes, so that edges recorded after the reset are not wiped with the old ones.
+        for (auto& edge : Detail::_callGraphEdges)
         {
-            auto* internal = static_cast<Detail::FunctionInternal*>(func);
-
-            internal->CallCount.store(0, std::memory_order_relaxed);
-            internal->TotalTimeNs.store(0, std::memory_order_relaxed);
-            internal->MinTimeNs.store(0, std::memory_order_relaxed);
-            internal->MaxTimeNs.store(0, std::memory_order_relaxed);
-            internal->SampleIndex.store(0, std::memory_order_relaxed);
-            internal->LastParent.store(nullptr, std::memory_order_relaxed);
+            edge.store(0, std::memory_order_relaxed);
+        }
 
-            for (auto& sample : internal->Samples)
-            {
-                sample.store(0, std::memory_order_relaxed);
-            }
+        {
+            // Each thread clears its own data the next time it records a call, until then it is ignored.
+            std::scoped_lock lock(Detail::getThreadsMutex());
+            Detail::_generation.fetch_add(1, std::memory_order_acq_rel);
+
+            // Threads that have exited can not record anything anymore.
+            auto& threads = Detail::getThreads();
+            threads.erase(
+                std::remove_if(
+                    threads.begin(), threads.end(),
+                    [](const auto& data) { return data->Retired.load(std::memory_order_acquire); }),
+                threads.end());
+        }
 
-            {
-                std::scoped_lock funcLock(internal->Mutex);
-                internal->Parents.clear();
-                internal->Children.clear();
-            }
+        for (auto* counter : Detail::getCounterRegistry())
+        {
+            counter->reset();
         }
     }
 
@@ -220,6 +580,15 @@ namespace OpenRCT2::Profiling
                 out << func->getTotalTime() << "\n";
             }
 
+            if (!Detail::getCounterRegistry().empty())
+            {
+                out << "\ncounter_name,value\n";
+                for (const auto* counter : Detail::getCounterRegistry())
+                {
+                    out << "\"" << counter->getName() << "\"," << counter->getValue() << "\n";
+                }
+            }
+
             return true;
         }
 
@@ -263,7 +632,13 @@ namespace OpenRCT2::Profiling
                     });
             }
 
-            json_t root = { { "functions", functions } };
+            json_t counters = json_t::array();
+            for (const auto* counter : Detail::getCounterRegistry())
+            {
+                counters.push_back({ { "name", counter->getName() }, { "value", counter->getValue() } });
+            }
+
+            json_t root = { { "functions", functions }, { "counters", counters } };
 
             try
             {
@@ -276,6 +651,15 @@ namespace OpenRCT2::Profiling
             }
         }
 
+        void appendTraceTime(std::string& out, const char* key, uint64_t timeNs)
+        {
+            // Trace timestamps are in microseconds.
+            char buffer[48];
+            std::snprintf(
+                buffer, sizeof(buffer), ",\"%s\":%" PRIu64 ".%03u", key, timeNs / 1000, static_cast<unsigned>(timeNs % 1000));
+            out += buffer;
+        }
+
         bool hasExtension(const std::string& path, const std::string& ext)
         {
             if (path.size() < ext.size())
@@ -295,4 +679,58 @@ namespace OpenRCT2::Profiling
         return writeCSV(filePath);
     }
 
+    std::string getTrace()
+    {
+        // Written by hand instead of building a json_t, as a trace can contain millions of events.
+        std::vector<std::string> names;
+        {
+            std::scoped_lock lock(Detail::getRegistryMutex());
+            for (const auto* func : Detail::getRegistry())
+            {
+                names.push_back(json_t(func->getName()).dump());
+            }
+        }
+
+        std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"OpenRCT2\"}}";
+        Detail::forEachThread([&](const Detail::ThreadData& data) {
+            const auto tid = std::to_string(data.Id);
+            const auto threadName = data.Name.empty() ? "Thread " + tid : data.Name;
+            out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid;
+            out += ",\"args\":{\"name\":" + json_t(threadName).dump() + "}}";
+
+            for (const auto& event : Detail::getEvents(data))
+            {
+                if (event.Id == Detail::kFrameMarkerId || event.Id == Detail::kTickMarkerId)
+                {
+                    // Global instant events are drawn across all threads.
+                    out += event.Id == Detail::kFrameMarkerId ? ",\n{\"name\":\"Frame\"" : ",\n{\"name\":\"Tick\"";
+                    out += ",\"cat\":\"marker\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" + tid;
+                    appendTraceTime(out, "ts", event.StartNs);
+                    out += "}";
+                }
+                else if (event.Id < names.size())
+                {
+                    out += ",\n{\"name\":" + names[event.Id];
+                    out += ",\"cat\":\"function\",\"ph\":\"X\",\"pid\":1,\"tid\":" + tid;
+                    appendTraceTime(out, "ts", event.StartNs);
+                    appendTraceTime(out, "dur", event.DurationNs);
+                    out += "}";
+                }
+            }
+        });
+        out += "\n]}\n";
+        return out;
+    }
+
+    bool exportTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath, std::ios::binary);
+        if (!out.is_open())
+            return false;
+
+        out << getTrace();
+        return out.good();
+    }
+
 } // namespace OpenRCT2::Profiling
@@ -10,7 +10,6 @@
 
 #include "ProfilingMacros.hpp"
 
-#include <array>
 #include <atomic>
 #include <cstdint>
 #include <mutex>
@@ -44,103 +43,85 @@ namespace OpenRCT2::Profiling
         virtual std::vector<Function*> getChildren() const = 0;
     };
 
-    namespace Detail
+    // A named value tracked alongside the function timings, such as allocation statistics.
+    // Counters are registered on construction and are expected to have static storage duration.
+    class Counter
     {
-        static constexpr size_t MaxSamplesSize = 1024;
-
-        struct FunctionInternal;
+        const char* _name;
+        std::atomic<uint64_t> _value{ 0 };
 
-        std::vector<Function*>& getRegistry();
-        std::mutex& getRegistryMutex();
-        void registerFunction(FunctionInternal* func);
+    public:
+        explicit Counter(const char* name);
 
-        struct FunctionInternal : Function
+        const char* getName() const noexcept
         {
-            FunctionInternal()
-            {
-                registerFunction(this);
-            }
-
-            virtual ~FunctionInternal() = default;
-
-            // Mutex only for call graph access, not the hot path.
-            mutable std::mutex Mutex;
-
-            // Atomic and lock free
-            std::atomic<uint64_t> CallCount{ 0 };
-            std::atomic<uint64_t> TotalTimeNs{ 0 };
-            std::atomic<uint64_t> MinTimeNs{ 0 };
-            std::atomic<uint64_t> MaxTimeNs{ 0 };
-
-            // Circular buffer for recent samples in nanoseconds
-            std::array<std::atomic<uint64_t>, MaxSamplesSize> Samples{};
-            std::atomic<size_t> SampleIndex{ 0 };
+            return _name;
+        }
 
-            // Call graph, protected by Mutex, but only accessed on new relationships
-            std::vector<FunctionInternal*> Parents;
-            std::vector<FunctionInternal*> Children;
+        uint64_t getValue() const noexcept
+        {
+            return _value.load(std::memory_order_relaxed);
+        }
 
-            // Fast path cache, skip lock if we just linked this parent
-            std::atomic<FunctionInternal*> LastParent{ nullptr };
+        void add(uint64_t amount) noexcept
+        {
+            _value.fetch_add(amount, std::memory_order_relaxed);
+        }
 
-            // Lock free min update
-            void updateMin(uint64_t value)
+        // Lock free max update
+        void updateMax(uint64_t value) noexcept
+        {
+            uint64_t current = _value.load(std::memory_order_relaxed);
+            while (value > current)
             {
-                uint64_t current = MinTimeNs.load(std::memory_order_relaxed);
-                while (current == 0 || value < current)
-                {
-                    if (MinTimeNs.compare_exchange_weak(current, value, std::memory_order_relaxed))
-                        break;
-                }
+                if (_value.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                    break;
             }
+        }
 
-            // Lock free max update
-            void updateMax(uint64_t value)
-            {
-                uint64_t current = MaxTimeNs.load(std::memory_order_relaxed);
-                while (value > current)
-                {
-                    if (MaxTimeNs.compare_exchange_weak(current, value, std::memory_order_relaxed))
-                        break;
-                }
-            }
+        void reset() noexcept
+        {
+            _value.store(0, std::memory_order_relaxed);
+        }
 
-            bool tryAddParent(FunctionInternal* parent);
-            bool tryAddChild(FunctionInternal* child);
+        // Not copyable and not movable
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+        Counter(Counter&&) = delete;
+        Counter& operator=(Counter&&) = delete;
+    };
 
-            uint64_t getCallCount() const noexcept override
-            {
-                return CallCount.load(std::memory_order_relaxed);
-            }
+    namespace Detail
+    {
+        static constexpr size_t MaxSamplesSize = 1024;
 
-            std::vector<double> getTimeSamples() const override;
+        struct FunctionInternal;
 
-            double getTotalTime() const override
-            {
-                return static_cast<double>(TotalTimeNs.load(std::memory_order_relaxed)) / 1000.0;
-            }
+        std::vector<Function*>& getRegistry();
+        std::mutex& getRegistryMutex();
+        void registerFunction(FunctionInternal* func);
 
-            double getMinTime() const override
-            {
-                return static_cast<double>(MinTimeNs.load(std::memory_order_relaxed)) / 1000.0;
-            }
+        // The timings are recorded by each thread into its own buffers without any shared writes, and are only merged
+        // when they are read, so that threads painting in parallel do not slow each other down.
+        struct FunctionInternal : Function
+        {
+            // Position in the registry, which is also the position of the function's statistics in the thread buffers.
+            uint32_t Index{};
 
-            double getMaxTime() const override
+            FunctionInternal()
             {
-                return static_cast<double>(MaxTimeNs.load(std::memory_order_relaxed)) / 1000.0;
+                registerFunction(this);
             }
 
-            std::vector<Function*> getParents() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return { Parents.begin(), Parents.end() };
-            }
+            virtual ~FunctionInternal() = default;
 
-            std::vector<Function*> getChildren() const override
-            {
-                std::scoped_lock lock(Mutex);
-                return { Children.begin(), Children.end() };
-            }
+            uint64_t getCallCount() const noexcept override;
+            std::vector<double> getTimeSamples() const override;
+            double getTotalTime() const override;
+            double getMinTime() const override;
+            double getMaxTime() const override;
+            std::vector<Function*> getParents() const override;
+            std::vector<Function*> getChildren() const override;
         };
 
         template<typename TName>
@@ -200,8 +181,25 @@ namespace OpenRCT2::Profiling
         ScopedProfiling& operator=(ScopedProfiling&&) = delete;
     };
 
+    enum class Marker : uint8_t
+    {
+        frame,
+        tick,
+    };
+
+    // Records the start of a frame or tick, shown across all threads in the trace.
+    void addMarker(Marker marker);
+
+    // Sets the name the calling thread is shown with in the trace.
+    void setThreadName(const char* name);
+
     void resetData();
     const std::vector<Function*>& getData();
+    const std::vector<Counter*>& getCounters();
     [[nodiscard]] bool exportData(const std::string& filePath);
 
+    // Returns the recorded calls of all threads in the Chrome trace event format, which can be opened in Perfetto.
+    [[nodiscard]] std::string getTrace();
+    [[nodiscard]] bool exportTrace(const std::string& filePath);
+
 } // namespace OpenRCT2::Profiling
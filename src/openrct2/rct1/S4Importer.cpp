@@ -179,6 +179,21 @@ namespace OpenRCT2::RCT1
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        void LoadScenarioMetadata(IStream* stream, const u8string& path = {}) override
+        {
+            // RCT1 parks are encoded as a whole, but the object mappings built by a full load are not needed for the
+            // scenario details.
+            _s4 = *ReadAndDecodeS4(stream, true);
+            _s4Path = path;
+            _isScenario = true;
+            _gameVersion = DetectRCT1Version(_s4.GameVersion) & FILE_VERSION_MASK;
+        }
+
+        void LoadParkPreview([[maybe_unused]] IStream* stream) override
+        {
+            // RCT1 files do not contain a preview.
+        }
+
         void Import(GameState_t& gameState) override
         {
             Initialise(gameState);
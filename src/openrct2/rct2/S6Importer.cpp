@@ -139,32 +139,7 @@ namespace OpenRCT2::RCT2
             IStream* stream, bool isScenario, bool skipObjectCheck = false, const u8string& path = {}) override
         {
             auto chunkReader = SawyerChunkReader(stream);
-            chunkReader.ReadChunk(&_s6.Header, sizeof(_s6.Header));
-
-            LOG_VERBOSE("saved game classic_flag = 0x%02x", _s6.Header.ClassicFlag);
-            if (isScenario)
-            {
-                if (_s6.Header.Type != S6_TYPE_SCENARIO)
-                {
-                    throw std::runtime_error("Park is not a scenario.");
-                }
-                chunkReader.ReadChunk(&_s6.Info, sizeof(_s6.Info));
-
-                // If the name or the details contain a colour code, they might be in UTF-8 already.
-                // This is caused by a bug that was in OpenRCT2 for 3 years.
-                if (!IsLikelyUTF8(_s6.Info.Name) && !IsLikelyUTF8(_s6.Info.Details))
-                {
-                    RCT2StringToUTF8Self(_s6.Info.Name, sizeof(_s6.Info.Name));
-                    RCT2StringToUTF8Self(_s6.Info.Details, sizeof(_s6.Info.Details));
-                }
-            }
-            else
-            {
-                if (_s6.Header.Type != S6_TYPE_SAVEDGAME)
-                {
-                    throw std::runtime_error("Park is not a saved game.");
-                }
-            }
+            ReadHeader(chunkReader, isScenario);
 
             // Read packed objects
             // TODO try to contain this more and not store objects until later
@@ -217,6 +192,50 @@ namespace OpenRCT2::RCT2
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        void LoadScenarioMetadata(IStream* stream, const u8string& path = {}) override
+        {
+            // The scenario info directly follows the header, so the rest of the file does not need to be decoded.
+            auto chunkReader = SawyerChunkReader(stream);
+            ReadHeader(chunkReader, true);
+            _isScenario = true;
+            _s6Path = path;
+        }
+
+        void LoadParkPreview([[maybe_unused]] IStream* stream) override
+        {
+            // RCT2 files do not contain a preview.
+        }
+
+        void ReadHeader(SawyerChunkReader& chunkReader, bool isScenario)
+        {
+            chunkReader.ReadChunk(&_s6.Header, sizeof(_s6.Header));
+
+            LOG_VERBOSE("saved game classic_flag = 0x%02x", _s6.Header.ClassicFlag);
+            if (isScenario)
+            {
+                if (_s6.Header.Type != S6_TYPE_SCENARIO)
+                {
+                    throw std::runtime_error("Park is not a scenario.");
+                }
+                chunkReader.ReadChunk(&_s6.Info, sizeof(_s6.Info));
+
+                // If the name or the details contain a colour code, they might be in UTF-8 already.
+                // This is caused by a bug that was in OpenRCT2 for 3 years.
+                if (!IsLikelyUTF8(_s6.Info.Name) && !IsLikelyUTF8(_s6.Info.Details))
+                {
+                    RCT2StringToUTF8Self(_s6.Info.Name, sizeof(_s6.Info.Name));
+                    RCT2StringToUTF8Self(_s6.Info.Details, sizeof(_s6.Info.Details));
+                }
+            }
+            else
+            {
+                if (_s6.Header.Type != S6_TYPE_SAVEDGAME)
+                {
+                    throw std::runtime_error("Park is not a saved game.");
+                }
+            }
+        }
+
         void ReadChunk6(SawyerChunkReader& chunkReader, uint32_t sizeWithoutEntities)
         {
             uint32_t entitiesSize = GetMaxEntities() * sizeof(Entity);
@@ -1289,6 +1289,7 @@ void RidePrepareBreakdown(Ride& ride, Breakdown breakdownReason)
                 if (vehicle != nullptr)
                 {
                     vehicle->flags.set(VehicleFlag::carIsBroken);
+                    getGameState().entities.MarkEntityTouched(vehicle->id);
                 }
             }
             break;
@@ -1302,6 +1303,7 @@ void RidePrepareBreakdown(Ride& ride, Breakdown breakdownReason)
             if (vehicle != nullptr)
             {
                 vehicle->flags.set(VehicleFlag::trainIsBroken);
+                getGameState().entities.MarkEntityTouched(vehicle->id);
             }
             break;
         case Breakdown::brakesFailure:
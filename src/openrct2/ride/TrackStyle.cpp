@@ -9,7 +9,12 @@
 
 #include "TrackStyle.h"
 
+#include "../core/EnumUtils.hpp"
 #include "TrackPaint.h"
+#include "ted/TrackElemType.h"
+
+#include <array>
+#include <type_traits>
 
 using TrackPaintFunctionGetter = TrackPaintFunction (*)(OpenRCT2::TrackElemType trackType);
 static TrackPaintFunction DummyGetter(OpenRCT2::TrackElemType trackType)
@@ -278,7 +283,39 @@ static constexpr TrackPaintFunctionGetter kPaintFunctionMap[] = {
 };
 static_assert(std::size(kPaintFunctionMap) == (sizeof(TrackStyle) * 256));
 
+using TrackPaintFunctionPtr = std::add_pointer_t<std::remove_reference_t<TrackPaintFunction>>;
+
+static constexpr size_t kNumTrackStyles = EnumValue(TrackStyle::woodenWildMouse) + 1;
+static constexpr size_t kNumTrackElemTypes = EnumValue(OpenRCT2::TrackElemType::count);
+
+using TrackPaintFunctionTable = std::array<std::array<TrackPaintFunctionPtr, kNumTrackElemTypes>, kNumTrackStyles>;
+
+// Resolves every (track style, track element) pair once so that painting a track element is a single table lookup
+// rather than a call into the style's getter followed by its switch.
+static const TrackPaintFunctionTable& GetTrackPaintFunctionTable()
+{
+    static const TrackPaintFunctionTable table = [] {
+        TrackPaintFunctionTable result{};
+        for (size_t style = 0; style < kNumTrackStyles; style++)
+        {
+            auto getter = kPaintFunctionMap[style];
+            for (size_t type = 0; type < kNumTrackElemTypes; type++)
+            {
+                result[style][type] = &getter(static_cast<OpenRCT2::TrackElemType>(type));
+            }
+        }
+        return result;
+    }();
+    return table;
+}
+
 TrackPaintFunction GetTrackPaintFunction(TrackStyle trackStyle, OpenRCT2::TrackElemType trackType)
 {
-    return kPaintFunctionMap[static_cast<uint8_t>(trackStyle)](trackType);
+    const auto style = EnumValue(trackStyle);
+    const auto type = EnumValue(trackType);
+    if (style >= kNumTrackStyles || type >= kNumTrackElemTypes)
+    {
+        return TrackPaintFunctionDummy;
+    }
+    return *GetTrackPaintFunctionTable()[style][type];
 }
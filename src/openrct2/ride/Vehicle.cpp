@@ -254,6 +254,13 @@ void VehicleUpdateAll()
     if (gLegacyScene == LegacyScene::trackDesigner && getGameState().editorStep != EditorStep::rollerCoasterDesigner)
         return;
 
+    // The cars of a train are updated through the head of the train.
+    auto& entities = getGameState().entities;
+    for (auto vehicleId : entities.GetEntityList(EntityType::vehicle))
+    {
+        entities.MarkEntityTouched(vehicleId);
+    }
+
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
@@ -183,7 +183,7 @@ protected:
     }
 
 private:
-    static std::unique_ptr<IStream> GetStreamFromRCT2Scenario(const std::string& path)
+    static std::unique_ptr<IStream> GetStreamFromScenario(const std::string& path)
     {
         if (String::iequals(Path::GetExtension(path), ".sea"))
         {
@@ -234,21 +234,20 @@ private:
             if (String::iequals(extension, ".park"))
             {
                 importer = ParkImporter::CreateParkFile(objRepository);
-                importer->LoadScenario(path, true);
             }
             else if (String::iequals(extension, ".sc4"))
             {
                 importer = ParkImporter::CreateS4();
-                importer->LoadScenario(path, true);
             }
             else
             {
                 importer = ParkImporter::CreateS6(objRepository);
-                auto stream = GetStreamFromRCT2Scenario(path);
-                // Skip packed object extraction during scanning - they'll be extracted when actually loading
-                importer->LoadFromStream(stream.get(), true, true);
             }
 
+            // Only the scenario details are read, the map and any packed objects are skipped.
+            auto stream = GetStreamFromScenario(path);
+            importer->LoadScenarioMetadata(stream.get(), path);
+
             if (importer)
             {
                 if (importer->PopulateIndexEntry(entry))
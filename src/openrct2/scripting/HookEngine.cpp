@@ -14,6 +14,8 @@
     #include "../core/EnumMap.hpp"
     #include "ScriptEngine.h"
 
+    #include <algorithm>
+
 using namespace OpenRCT2::Scripting;
 
 static const EnumMap<HookType> HooksLookupTable(
@@ -43,6 +45,30 @@ HookType OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HookType::notDefined;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HookType type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view{};
+}
+
+bool HookFilter::IsEmpty() const
+{
+    return Actions.empty() && CustomActions.empty();
+}
+
+bool HookFilter::MatchesAction(GameCommand type, std::string_view customActionId) const
+{
+    if (IsEmpty())
+    {
+        return true;
+    }
+    if (type == GameCommand::Custom)
+    {
+        return std::find(CustomActions.begin(), CustomActions.end(), customActionId) != CustomActions.end();
+    }
+    return std::find(Actions.begin(), Actions.end(), type) != Actions.end();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -53,11 +79,12 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HookType type, const std::shared_ptr<Plugin>& owner, const JSCallback& function)
+uint32_t HookEngine::Subscribe(
+    HookType type, const std::shared_ptr<Plugin>& owner, const JSCallback& function, HookFilter filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(filter));
     return cookie;
 }
 
@@ -114,6 +141,7 @@ void HookEngine::Call(HookType type, bool isGameStateMutable)
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        hook.Delivered++;
         _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function.callback, {}, isGameStateMutable);
     }
 }
@@ -123,6 +151,7 @@ void HookEngine::Call(HookType type, const JSValue arg, bool isGameStateMutable,
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        hook.Delivered++;
         JSContext* ctx = hook.Owner ? hook.Owner->GetContext() : _scriptEngine.GetContext();
         _scriptEngine.ExecutePluginCall(
             hook.Owner, hook.Function.callback, { JS_DupValue(ctx, arg) }, isGameStateMutable, false);
@@ -142,6 +171,7 @@ void HookEngine::Call(
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
+        hook.Delivered++;
         JSContext* ctx = hook.Owner.get()->GetContext();
 
         // Convert key/value pairs into an object
@@ -165,6 +195,53 @@ void HookEngine::Call(
     }
 }
 
+bool HookEngine::HasActionSubscriptions(HookType type, GameCommand actionType, std::string_view customActionId)
+{
+    auto& hookList = GetHookList(type);
+    bool hasSubscriptions = false;
+    for (auto& hook : hookList.Hooks)
+    {
+        if (hook.Filter.MatchesAction(actionType, customActionId))
+        {
+            hasSubscriptions = true;
+        }
+        else
+        {
+            hook.Skipped++;
+        }
+    }
+    return hasSubscriptions;
+}
+
+void HookEngine::CallActionHooks(
+    HookType type, GameCommand actionType, std::string_view customActionId, JSValue arg, bool isGameStateMutable)
+{
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (!hook.Filter.MatchesAction(actionType, customActionId))
+            continue;
+
+        hook.Delivered++;
+        JSContext* ctx = hook.Owner ? hook.Owner->GetContext() : _scriptEngine.GetContext();
+        _scriptEngine.ExecutePluginCall(
+            hook.Owner, hook.Function.callback, { JS_DupValue(ctx, arg) }, isGameStateMutable, false);
+    }
+}
+
+std::vector<HookStatistics> HookEngine::GetStatistics() const
+{
+    std::vector<HookStatistics> result;
+    for (const auto& hookList : _hookMap)
+    {
+        for (const auto& hook : hookList.Hooks)
+        {
+            result.push_back({ hookList.Type, hook.Owner, hook.Delivered, hook.Skipped });
+        }
+    }
+    return result;
+}
+
 HookList& HookEngine::GetHookList(HookType type)
 {
     auto index = static_cast<size_t>(type);
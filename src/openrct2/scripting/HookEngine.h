@@ -11,11 +11,13 @@
 
 #ifdef ENABLE_SCRIPTING
 
+    #include "../actions/GameCommand.h"
     #include "ScriptUtil.hpp"
 
     #include <any>
     #include <memory>
     #include <string>
+    #include <string_view>
     #include <variant>
     #include <vector>
 
@@ -49,6 +51,7 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HookTypeS = static_cast<size_t>(HookType::count);
     HookType GetHookType(const std::string& name);
+    std::string_view GetHookName(HookType type);
 
     using HookValue = std::variant<int32_t, int16_t, uint16_t, std::string>;
 
@@ -58,17 +61,34 @@ namespace OpenRCT2::Scripting
         using Ts::operator()...;
     };
 
+    /**
+     * Restricts the events of a hook that are passed to a subscriber. It is checked before an event is converted for the
+     * script, so events the subscriber is not interested in cost next to nothing.
+     */
+    struct HookFilter
+    {
+        std::vector<GameCommand> Actions;
+        std::vector<std::string> CustomActions;
+
+        bool IsEmpty() const;
+        bool MatchesAction(GameCommand type, std::string_view customActionId) const;
+    };
+
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         JSCallback Function;
+        HookFilter Filter;
+        uint64_t Delivered{};
+        uint64_t Skipped{};
 
         Hook() = default;
-        Hook(uint32_t cookie, const std::shared_ptr<Plugin>& owner, const JSCallback& function)
+        Hook(uint32_t cookie, const std::shared_ptr<Plugin>& owner, const JSCallback& function, HookFilter filter)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Filter(std::move(filter))
         {
         }
     };
@@ -83,6 +103,14 @@ namespace OpenRCT2::Scripting
         HookList(HookList&& src) = default;
     };
 
+    struct HookStatistics
+    {
+        HookType Type{};
+        std::shared_ptr<Plugin> Owner;
+        uint64_t Delivered{};
+        uint64_t Skipped{};
+    };
+
     class HookEngine
     {
     private:
@@ -93,7 +121,8 @@ namespace OpenRCT2::Scripting
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HookType type, const std::shared_ptr<Plugin>& owner, const JSCallback& function);
+        uint32_t Subscribe(
+            HookType type, const std::shared_ptr<Plugin>& owner, const JSCallback& function, HookFilter filter = {});
         void Unsubscribe(HookType type, uint32_t cookie);
         void UnsubscribeAll(const std::shared_ptr<const Plugin>& owner);
         void UnsubscribeAll();
@@ -103,6 +132,14 @@ namespace OpenRCT2::Scripting
         void Call(HookType type, JSValue arg, bool isGameStateMutable, bool keepArgsAlive = false);
         void Call(HookType type, const std::initializer_list<std::pair<std::string, HookValue>>& args, bool isGameStateMutable);
 
+        // Counts the action as skipped for every hook whose filter rejects it, returns whether any hook accepts it.
+        bool HasActionSubscriptions(HookType type, GameCommand actionType, std::string_view customActionId);
+        // Calls the hooks whose filter accepts the action, the argument is not freed.
+        void CallActionHooks(
+            HookType type, GameCommand actionType, std::string_view customActionId, JSValue arg, bool isGameStateMutable);
+
+        std::vector<HookStatistics> GetStatistics() const;
+
     private:
         HookList& GetHookList(HookType type);
         const HookList& GetHookList(HookType type) const;
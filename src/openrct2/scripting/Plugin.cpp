@@ -60,7 +60,11 @@ void Plugin::Load()
     JS_SetPropertyStr(_context, glb, "registerPlugin", registerFunc);
     JS_FreeValue(_context, glb);
 
-    JSValue res = JS_Eval(_context, _code.c_str(), _code.length(), _path.c_str(), JS_EVAL_TYPE_GLOBAL);
+    JSValue res = scriptEngine.GetBytecodeCache().Compile(_context, _code, _path);
+    if (!JS_IsException(res))
+    {
+        res = JS_EvalFunction(_context, res);
+    }
     if (JS_IsException(res))
     {
         JSValue exceptionVal = JS_GetException(_context);
@@ -0,0 +1,173 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+    #include "PluginBytecodeCache.h"
+
+    #include "../Diagnostic.h"
+    #include "../Version.h"
+    #include "../core/Crypt.h"
+    #include "../core/File.h"
+    #include "../core/FileStream.h"
+    #include "../core/Path.hpp"
+    #include "../core/String.hpp"
+
+    #include <cinttypes>
+    #include <cstring>
+    #include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Scripting;
+
+static constexpr uint32_t kBytecodeCacheMagic = 0x43425250; // PRBC
+static constexpr uint32_t kBytecodeCacheVersion = 1;
+
+static uint64_t HashCode(std::string_view code)
+{
+    auto hash = Crypt::FNV1a(code.data(), code.size());
+    uint64_t result;
+    std::memcpy(&result, hash.data(), sizeof(result));
+    return result;
+}
+
+PluginBytecodeCache::PluginBytecodeCache(u8string directory, size_t maxNetworkEntries)
+    : _directory(std::move(directory))
+    , _maxNetworkEntries(maxNetworkEntries)
+{
+}
+
+JSValue PluginBytecodeCache::Compile(JSContext* ctx, const std::string& code, const std::string& fileName)
+{
+    const auto path = GetCachePath(code, fileName);
+    JSValue function = TryRead(ctx, path, code);
+    if (!JS_IsUndefined(function))
+    {
+        _numHits++;
+        return function;
+    }
+
+    function = JS_Eval(ctx, code.c_str(), code.size(), fileName.c_str(), JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (!JS_IsException(function))
+    {
+        Write(ctx, path, code, function);
+        if (fileName.empty())
+        {
+            PruneNetworkEntries(path);
+        }
+    }
+    return function;
+}
+
+u8string PluginBytecodeCache::GetNetworkDirectory() const
+{
+    return Path::Combine(_directory, u8"network");
+}
+
+u8string PluginBytecodeCache::GetCachePath(std::string_view code, const std::string& fileName) const
+{
+    // Plugins loaded from a file get one entry each, which is replaced when the file changes. Network plugins do not
+    // have a file, so they are identified by their code instead and get a new entry whenever a server changes them.
+    if (fileName.empty())
+    {
+        return Path::Combine(GetNetworkDirectory(), String::stdFormat("%016" PRIx64 ".qjsc", HashCode(code)));
+    }
+    return Path::Combine(_directory, String::stdFormat("%016" PRIx64 ".qjsc", HashCode(fileName)));
+}
+
+JSValue PluginBytecodeCache::TryRead(JSContext* ctx, const u8string& path, std::string_view code) const
+{
+    if (!File::Exists(path))
+    {
+        return JS_UNDEFINED;
+    }
+
+    std::vector<uint8_t> bytecode;
+    try
+    {
+        FileStream fs(path, FileMode::open);
+        if (fs.ReadValue<uint32_t>() != kBytecodeCacheMagic || fs.ReadValue<uint32_t>() != kBytecodeCacheVersion)
+            return JS_UNDEFINED;
+
+        // The bytecode format is only compatible with the same build of QuickJS.
+        if (fs.ReadString() != gVersionInfoFull || fs.ReadString() != JS_GetVersion())
+            return JS_UNDEFINED;
+
+        if (fs.ReadValue<uint64_t>() != code.size() || fs.ReadValue<uint64_t>() != HashCode(code))
+            return JS_UNDEFINED;
+
+        const auto length = fs.ReadValue<uint64_t>();
+        if (length != fs.GetLength() - fs.GetPosition())
+            return JS_UNDEFINED;
+
+        bytecode.resize(length);
+        fs.Read(bytecode.data(), length);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read plugin bytecode cache '%s': %s", path.c_str(), e.what());
+        return JS_UNDEFINED;
+    }
+
+    JSValue function = JS_ReadObject(ctx, bytecode.data(), bytecode.size(), JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(function))
+    {
+        // Compile the code again and replace the entry.
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return JS_UNDEFINED;
+    }
+    return function;
+}
+
+void PluginBytecodeCache::Write(JSContext* ctx, const u8string& path, std::string_view code, JSValue function) const
+{
+    size_t length = 0;
+    uint8_t* bytecode = JS_WriteObject(ctx, &length, function, JS_WRITE_OBJ_BYTECODE);
+    if (bytecode == nullptr)
+    {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return;
+    }
+
+    // Written to a temporary file first, so that another instance of the game never reads a partially written entry.
+    const auto tempPath = path + u8".tmp";
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            FileStream fs(tempPath, FileMode::write);
+            fs.WriteValue<uint32_t>(kBytecodeCacheMagic);
+            fs.WriteValue<uint32_t>(kBytecodeCacheVersion);
+            fs.WriteString(gVersionInfoFull);
+            fs.WriteString(JS_GetVersion());
+            fs.WriteValue<uint64_t>(code.size());
+            fs.WriteValue<uint64_t>(HashCode(code));
+            fs.WriteValue<uint64_t>(length);
+            fs.Write(bytecode, length);
+        }
+        if (!File::Move(tempPath, path))
+        {
+            LOG_WARNING("Unable to replace plugin bytecode cache '%s'", path.c_str());
+            File::Delete(tempPath);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to write plugin bytecode cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+    js_free(ctx, bytecode);
+}
+
+void PluginBytecodeCache::PruneNetworkEntries(const u8string& keepPath) const
+{
+    File::DeleteOldestFiles(GetNetworkDirectory(), u8"*.qjsc", _maxNetworkEntries, keepPath);
+}
+
+#endif
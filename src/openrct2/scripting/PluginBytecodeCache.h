@@ -0,0 +1,65 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+    #include "../core/StringTypes.h"
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <quickjs.h>
+    #include <string>
+    #include <string_view>
+
+namespace OpenRCT2::Scripting
+{
+    /**
+     * Keeps the QuickJS bytecode of compiled plugins in the cache directory, so that plugins whose code has not changed
+     * since the last time they were loaded do not need to be parsed and compiled again. Network plugins are kept apart
+     * from plugins loaded from a file, and only the most recently compiled ones are kept.
+     */
+    class PluginBytecodeCache
+    {
+    private:
+        u8string _directory;
+        size_t _maxNetworkEntries;
+        uint32_t _numHits{};
+
+    public:
+        static constexpr size_t kDefaultMaxNetworkEntries = 64;
+
+        explicit PluginBytecodeCache(u8string directory, size_t maxNetworkEntries = kDefaultMaxNetworkEntries);
+
+        /**
+         * Compiles the given code as a global script, or reads it from the cache if it was compiled before by the same
+         * version of the game. The returned function still has to be run with JS_EvalFunction. Returns an exception if the
+         * code does not compile.
+         */
+        JSValue Compile(JSContext* ctx, const std::string& code, const std::string& fileName);
+
+        /**
+         * Returns the number of times Compile used the bytecode from the cache.
+         */
+        uint32_t GetNumHits() const
+        {
+            return _numHits;
+        }
+
+    private:
+        u8string GetNetworkDirectory() const;
+        u8string GetCachePath(std::string_view code, const std::string& fileName) const;
+        JSValue TryRead(JSContext* ctx, const u8string& path, std::string_view code) const;
+        void Write(JSContext* ctx, const u8string& path, std::string_view code, JSValue function) const;
+        void PruneNetworkEntries(const u8string& keepPath) const;
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -471,6 +471,7 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
     : _console(console)
     , _env(env)
     , _hookEngine(*this)
+    , _bytecodeCache(Path::Combine(env.GetDirectoryPath(DirBase::cache), u8"plugin_bytecode"))
 {
 }
 
@@ -1747,10 +1748,29 @@ static std::unique_ptr<GameActions::GameAction> CreateGameActionFromActionId(con
     return nullptr;
 }
 
+GameCommand ScriptEngine::StringToActionType(std::string_view actionName)
+{
+    auto result = ActionNameToType.find(actionName);
+    if (result != ActionNameToType.end())
+    {
+        return result->second;
+    }
+    return GameCommand::Custom;
+}
+
 void ScriptEngine::RunGameActionHooks(const GameActions::GameAction& action, GameActions::Result& result, bool isExecute)
 {
     auto hookType = isExecute ? HookType::actionExecute : HookType::actionQuery;
-    if (_hookEngine.HasSubscriptions(hookType))
+    if (!_hookEngine.HasSubscriptions(hookType))
+        return;
+
+    // Check the filters first so that actions no hook is interested in are never converted for the scripts.
+    std::string_view customActionId;
+    if (action.GetType() == GameCommand::Custom)
+    {
+        customActionId = static_cast<const GameActions::CustomAction&>(action).GetId();
+    }
+    if (_hookEngine.HasActionSubscriptions(hookType, action.GetType(), customActionId))
     {
         JSContext* ctx = _replContext;
         JSValue obj = JS_NewObject(ctx);
@@ -1795,7 +1815,7 @@ void ScriptEngine::RunGameActionHooks(const GameActions::GameAction& action, Gam
 
         JS_SetPropertyStr(ctx, obj, "result", GameActionResultToJS(ctx, action, result));
 
-        _hookEngine.Call(hookType, obj, false, true);
+        _hookEngine.CallActionHooks(hookType, actionId, customActionId, obj, false);
 
         if (!isExecute)
         {
@@ -15,6 +15,7 @@
     #include "../management/Finance.h"
     #include "HookEngine.h"
     #include "Plugin.h"
+    #include "PluginBytecodeCache.h"
 
     #include <future>
     #include <memory>
@@ -43,7 +44,7 @@ namespace OpenRCT2
 namespace OpenRCT2::Scripting
 {
     // Grepped from CI (.github/workflows/publish-plugin-types.yml); keep the format `kPluginApiVersion = N`.
-    static constexpr int32_t kPluginApiVersion = 114;
+    static constexpr int32_t kPluginApiVersion = 116;
 
     // Versions marking breaking changes.
     static constexpr int32_t kApiVersionPeepDeprecation = 33;
@@ -135,6 +136,7 @@ namespace OpenRCT2::Scripting
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
+        PluginBytecodeCache _bytecodeCache;
         ScriptExecutionInfo _execInfo;
         JSValue _sharedStorage = JS_UNDEFINED;
         JSValue _parkStorage = JS_UNDEFINED;
@@ -188,6 +190,10 @@ namespace OpenRCT2::Scripting
         {
             return _hookEngine;
         }
+        PluginBytecodeCache& GetBytecodeCache()
+        {
+            return _bytecodeCache;
+        }
         ScriptExecutionInfo& GetExecInfo()
         {
             return _execInfo;
@@ -272,6 +278,8 @@ namespace OpenRCT2::Scripting
 
         static std::string_view ExpenditureTypeToString(ExpenditureType expenditureType);
         static ExpenditureType StringToExpenditureType(std::string_view expenditureType);
+        // Returns GameCommand::Custom for names that are not a built-in action.
+        static GameCommand StringToActionType(std::string_view actionName);
 
     #ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<SocketDataBase>& data);
@@ -79,6 +79,7 @@ namespace OpenRCT2::Scripting
             auto* litter = GetLitter(thisVal);
             litter->subType = it->second;
             litter->invalidate();
+            getGameState().entities.MarkEntityTouched(litter->id);
         }
         return JS_UNDEFINED;
     }
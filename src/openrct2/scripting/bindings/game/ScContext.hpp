@@ -286,7 +286,26 @@ namespace OpenRCT2::Scripting
                 return JS_EXCEPTION;
             }
 
-            auto cookie = hookEngine.Subscribe(hookType, owner, callback);
+            HookFilter filter;
+            if (argc > 2 && !JS_IsUndefined(argv[2]))
+            {
+                if (hookType != HookType::actionQuery && hookType != HookType::actionExecute)
+                {
+                    JS_ThrowPlainError(ctx, "Filters are only supported for action.query and action.execute.");
+                    return JS_EXCEPTION;
+                }
+                JS_UNPACK_OBJECT(filterObj, ctx, argv[2]);
+                JSIterateArray(ctx, filterObj, "actions", [&filter](JSContext* ctx2, JSValue val) {
+                    auto actionName = JSToStdString(ctx2, val);
+                    auto actionType = ScriptEngine::StringToActionType(actionName);
+                    if (actionType == GameCommand::Custom)
+                        filter.CustomActions.push_back(std::move(actionName));
+                    else
+                        filter.Actions.push_back(actionType);
+                });
+            }
+
+            auto cookie = hookEngine.Subscribe(hookType, owner, callback, std::move(filter));
             return gScDisposable.New(ctx, [&hookEngine, hookType, cookie]() { hookEngine.Unsubscribe(hookType, cookie); });
         }
 
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+    #include "../../../Context.h"
     #include "../../../profiling/Profiling.h"
     #include "../../ScriptEngine.h"
 namespace OpenRCT2::Scripting
@@ -58,6 +59,29 @@ namespace OpenRCT2::Scripting
             return profileData;
         }
 
+        static JSValue getHookData(JSContext* ctx, JSValue, int, JSValue*)
+        {
+            const auto statistics = GetContext()->GetScriptEngine().GetHookEngine().GetStatistics();
+            JSValue hookData = JS_NewArray(ctx);
+            int64_t index = 0;
+            for (const auto& item : statistics)
+            {
+                JSValue val = JS_NewObject(ctx);
+                JS_SetPropertyStr(ctx, val, "hook", JSFromStdString(ctx, GetHookName(item.Type)));
+                auto pluginName = item.Owner != nullptr ? item.Owner->GetMetadata().Name : std::string();
+                JS_SetPropertyStr(ctx, val, "plugin", JSFromStdString(ctx, pluginName));
+                JS_SetPropertyStr(ctx, val, "delivered", JS_NewInt64(ctx, item.Delivered));
+                JS_SetPropertyStr(ctx, val, "skipped", JS_NewInt64(ctx, item.Skipped));
+                JS_SetPropertyInt64(ctx, hookData, index++, val);
+            }
+            return hookData;
+        }
+
+        static JSValue getTrace(JSContext* ctx, JSValue, int, JSValue*)
+        {
+            return JSFromStdString(ctx, Profiling::getTrace());
+        }
+
         static JSValue start(JSContext*, JSValue, int, JSValue*)
         {
             Profiling::enable();
@@ -91,6 +115,8 @@ namespace OpenRCT2::Scripting
         {
             static constexpr JSCFunctionListEntry funcs[] = {
                 JS_CFUNC_DEF("getData", 0, ScProfiler::getData),
+                JS_CFUNC_DEF("getHookData", 0, ScProfiler::getHookData),
+                JS_CFUNC_DEF("getTrace", 0, ScProfiler::getTrace),
                 JS_CFUNC_DEF("start", 0, ScProfiler::start),
                 JS_CFUNC_DEF("stop", 0, ScProfiler::stop),
                 JS_CFUNC_DEF("reset", 0, ScProfiler::reset),
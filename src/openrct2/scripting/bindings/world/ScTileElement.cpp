@@ -111,6 +111,7 @@ namespace OpenRCT2::Scripting
             return JS_UNDEFINED;
         }
         CreateBannerEntryIfNeeded(element, data->coords);
+        FootpathBinIndexMarkTile(data->coords);
         Invalidate(data);
         return JS_UNDEFINED;
     }
@@ -2024,6 +2025,7 @@ namespace OpenRCT2::Scripting
                 if (addition <= 254)
                 {
                     el->SetAdditionEntryIndex(addition);
+                    FootpathBinIndexMarkTile(data->coords);
                 }
             }
             else
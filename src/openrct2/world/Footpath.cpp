@@ -37,6 +37,7 @@
 #include "Location.hpp"
 #include "Map.h"
 #include "MapAnimation.h"
+#include "TileElementsView.h"
 #include "Wall.h"
 #include "tile_element/BannerElement.h"
 #include "tile_element/EntranceElement.h"
@@ -1947,4 +1948,62 @@ namespace OpenRCT2
 
         return { baseZ, slope };
     }
+
+    // One bit per tile, set if the tile may contain a path with a bin. Bits are only cleared by a full rebuild, so a bin is
+    // never missed and staff and guests behave exactly as if every tile was scanned.
+    static std::vector<bool> _binIndex;
+    static bool _binIndexIsValid = false;
+
+    static void FootpathBinIndexRebuild()
+    {
+        _binIndex.assign(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, false);
+        const auto mapSize = getGameState().mapSize;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                for (auto* pathElement : TileElementsView<PathElement>(TileCoordsXY{ x, y }.ToCoordsXY()))
+                {
+                    if (!pathElement->HasAddition())
+                        continue;
+
+                    auto* pathAddEntry = pathElement->GetAdditionEntry();
+                    if (pathAddEntry != nullptr && (pathAddEntry->flags & PATH_ADDITION_FLAG_IS_BIN))
+                    {
+                        _binIndex[x + (y * kMaximumMapSizeTechnical)] = true;
+                        break;
+                    }
+                }
+            }
+        }
+        _binIndexIsValid = true;
+    }
+
+    void FootpathBinIndexInvalidate()
+    {
+        _binIndexIsValid = false;
+    }
+
+    void FootpathBinIndexMarkTile(const CoordsXY& footpathPos)
+    {
+        const TileCoordsXY tilePos{ footpathPos };
+        if (_binIndexIsValid && tilePos.x >= 0 && tilePos.y >= 0 && tilePos.x < kMaximumMapSizeTechnical
+            && tilePos.y < kMaximumMapSizeTechnical)
+        {
+            _binIndex[tilePos.x + (tilePos.y * kMaximumMapSizeTechnical)] = true;
+        }
+    }
+
+    bool FootpathBinIndexMayContainBin(const CoordsXY& footpathPos)
+    {
+        const TileCoordsXY tilePos{ footpathPos };
+        if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+            return true;
+
+        if (!_binIndexIsValid)
+        {
+            FootpathBinIndexRebuild();
+        }
+        return _binIndex[tilePos.x + (tilePos.y * kMaximumMapSizeTechnical)];
+    }
 } // namespace OpenRCT2
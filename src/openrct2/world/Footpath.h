@@ -204,4 +204,8 @@ namespace OpenRCT2
 
     FootpathPlacementResult FootpathGetOnTerrainPlacement(const TileCoordsXY& location);
     FootpathPlacementResult FootpathGetOnTerrainPlacement(const SurfaceElement& surfaceElement);
+
+    void FootpathBinIndexInvalidate();
+    void FootpathBinIndexMarkTile(const CoordsXY& footpathPos);
+    bool FootpathBinIndexMayContainBin(const CoordsXY& footpathPos);
 } // namespace OpenRCT2
@@ -92,6 +92,9 @@ namespace OpenRCT2
 
     constexpr size_t MIN_TILE_ELEMENTS = 1024;
 
+    // Minimum number of free elements kept at the end of a region after it has been compacted
+    constexpr size_t kMinFreeRegionTileElements = 32;
+
     uint32_t gLandRemainingOwnershipSales;
     uint32_t gLandRemainingConstructionSales;
 
@@ -99,7 +102,7 @@ namespace OpenRCT2
 
     static TilePointerIndex<TileElement> _tileIndex;
     static TilePointerIndex<TileElement> _tileIndexStash;
-    static std::vector<TileElement> _tileElementsStash;
+    static std::vector<std::vector<TileElement>> _tileElementsStash;
     static size_t _tileElementsInUse;
     static size_t _tileElementsInUseStash;
     static TileCoordsXY _mapSizeStash;
@@ -108,7 +111,7 @@ namespace OpenRCT2
     {
         auto& gameState = getGameState();
         _tileIndexStash = std::move(_tileIndex);
-        _tileElementsStash = std::move(gameState.tileElements);
+        _tileElementsStash = std::move(gameState.tileElementRegions);
         _mapSizeStash = gameState.mapSize;
         _tileElementsInUseStash = _tileElementsInUse;
     }
@@ -117,7 +120,7 @@ namespace OpenRCT2
     {
         auto& gameState = getGameState();
         _tileIndex = std::move(_tileIndexStash);
-        gameState.tileElements = std::move(_tileElementsStash);
+        gameState.tileElementRegions = std::move(_tileElementsStash);
         gameState.mapSize = _mapSizeStash;
         _tileElementsInUse = _tileElementsInUseStash;
     }
@@ -138,17 +141,60 @@ namespace OpenRCT2
         return GetMapSizeUnits() - CoordsXY{ 1, 1 };
     }
 
-    const std::vector<TileElement>& GetTileElements()
+    size_t GetTileElementCount()
     {
-        return getGameState().tileElements;
+        return _tileElementsInUse;
+    }
+
+    static size_t GetTileElementRegionCapacity(size_t numElements)
+    {
+        return numElements + std::max(numElements / 4, kMinFreeRegionTileElements);
     }
 
     void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElements)
     {
-        gameState.tileElements = std::move(tileElements);
-        _tileIndex = TilePointerIndex<TileElement>(
-            kMaximumMapSizeTechnical, gameState.tileElements.data(), gameState.tileElements.size());
-        _tileElementsInUse = gameState.tileElements.size();
+        // Split the elements up by region so that running out of space only ever affects a single region
+        auto linearIndex = TilePointerIndex<TileElement>(kMaximumMapSizeTechnical, tileElements.data(), tileElements.size());
+        _tileIndex = TilePointerIndex<TileElement>(kMaximumMapSizeTechnical);
+
+        auto& regions = gameState.tileElementRegions;
+        regions.clear();
+        regions.resize(_tileIndex.GetRegionCount());
+
+        std::vector<uint32_t> tileOffsets(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+        for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+        {
+            for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+            {
+                const auto tilePos = TileCoordsXY{ x, y };
+                auto& region = regions[_tileIndex.GetRegionIndex(tilePos)];
+                tileOffsets[x + (y * kMaximumMapSizeTechnical)] = static_cast<uint32_t>(region.size());
+
+                const auto* element = linearIndex.GetFirstElementAt(tilePos);
+                do
+                {
+                    region.push_back(*element);
+                } while (!(element++)->isLastForTile());
+            }
+        }
+
+        for (auto& region : regions)
+        {
+            region.reserve(GetTileElementRegionCapacity(region.size()));
+        }
+
+        for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+        {
+            for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+            {
+                const auto tilePos = TileCoordsXY{ x, y };
+                auto& region = regions[_tileIndex.GetRegionIndex(tilePos)];
+                _tileIndex.SetTile(tilePos, &region[tileOffsets[x + (y * kMaximumMapSizeTechnical)]]);
+            }
+        }
+
+        _tileElementsInUse = tileElements.size();
+        FootpathBinIndexInvalidate();
     }
 
     static TileElement GetDefaultSurfaceElement()
@@ -171,7 +217,7 @@ namespace OpenRCT2
     std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
     {
         std::vector<TileElement> newElements;
-        newElements.reserve(std::max(MIN_TILE_ELEMENTS, getGameState().tileElements.size()));
+        newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElementsInUse));
         for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
         {
             for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
@@ -206,12 +252,12 @@ namespace OpenRCT2
         return newElements;
     }
 
-    static void ReorganiseTileElements(GameState_t& gameState, size_t capacity)
+    static void ReorganiseTileElements(GameState_t& gameState)
     {
         ContextSetCurrentCursor(CursorID::ZZZ);
 
         std::vector<TileElement> newElements;
-        newElements.reserve(std::max(MIN_TILE_ELEMENTS, capacity));
+        newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElementsInUse));
         for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
         {
             for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
@@ -234,19 +280,73 @@ namespace OpenRCT2
         SetTileElements(gameState, std::move(newElements));
     }
 
-    static void ReorganiseTileElements(size_t capacity)
+    void ReorganiseTileElements()
     {
         auto& gameState = getGameState();
-        ReorganiseTileElements(gameState, capacity);
+        ReorganiseTileElements(gameState);
     }
 
-    void ReorganiseTileElements()
+    /**
+     * Rebuilds the region containing the given tile without the holes left behind by moved or removed elements,
+     * leaving at least the requested number of free elements at the end. Only tiles within the region are moved.
+     */
+    static void CompactTileElementRegion(GameState_t& gameState, const TileCoordsXY& tilePos, size_t numFreeElements)
     {
-        auto& gameState = getGameState();
-        ReorganiseTileElements(gameState, gameState.tileElements.size());
+        constexpr int32_t kRegionSize = TilePointerIndex<TileElement>::kRegionSize;
+        const auto regionStart = TileCoordsXY{ (tilePos.x / kRegionSize) * kRegionSize,
+                                               (tilePos.y / kRegionSize) * kRegionSize };
+        const auto regionEnd = TileCoordsXY{ std::min<int32_t>(regionStart.x + kRegionSize, kMaximumMapSizeTechnical),
+                                             std::min<int32_t>(regionStart.y + kRegionSize, kMaximumMapSizeTechnical) };
+
+        size_t numElementsInUse = 0;
+        for (int32_t y = regionStart.y; y < regionEnd.y; y++)
+        {
+            for (int32_t x = regionStart.x; x < regionEnd.x; x++)
+            {
+                const auto* element = _tileIndex.GetFirstElementAt(TileCoordsXY{ x, y });
+                if (element == nullptr)
+                {
+                    numElementsInUse++;
+                    continue;
+                }
+                do
+                {
+                    numElementsInUse++;
+                } while (!(element++)->isLastForTile());
+            }
+        }
+
+        // Reserving up front keeps the new tile pointers valid while the region is being rebuilt
+        std::vector<TileElement> newElements;
+        newElements.reserve(GetTileElementRegionCapacity(numElementsInUse + numFreeElements));
+        for (int32_t y = regionStart.y; y < regionEnd.y; y++)
+        {
+            for (int32_t x = regionStart.x; x < regionEnd.x; x++)
+            {
+                const auto regionTilePos = TileCoordsXY{ x, y };
+                const auto* element = _tileIndex.GetFirstElementAt(regionTilePos);
+                auto* newFirstElement = &newElements.emplace_back();
+                if (element == nullptr)
+                {
+                    *newFirstElement = GetDefaultSurfaceElement();
+                }
+                else
+                {
+                    *newFirstElement = *element;
+                    while (!(element++)->isLastForTile())
+                    {
+                        newElements.push_back(*element);
+                    }
+                }
+                _tileIndex.SetTile(regionTilePos, newFirstElement);
+            }
+        }
+
+        gameState.tileElementRegions[_tileIndex.GetRegionIndex(tilePos)] = std::move(newElements);
     }
 
-    static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t numNewElements)
+    static bool MapCheckFreeElementsAndReorganise(
+        const TileCoordsXY& tilePos, size_t numElementsOnTile, size_t numNewElements)
     {
         // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
         if (_tileElementsInUse + numNewElements > kMaxTileElements)
@@ -255,28 +355,16 @@ namespace OpenRCT2
         }
 
         auto& gameState = getGameState();
+        const auto& region = gameState.tileElementRegions[_tileIndex.GetRegionIndex(tilePos)];
         auto totalElementsRequired = numElementsOnTile + numNewElements;
-        auto freeElements = gameState.tileElements.capacity() - gameState.tileElements.size();
+        auto freeElements = region.capacity() - region.size();
         if (freeElements >= totalElementsRequired)
         {
             return true;
         }
 
-        // if space issue is due to fragmentation then Reorg Tiles without increasing capacity
-        if (gameState.tileElements.size() > totalElementsRequired + _tileElementsInUse)
-        {
-            ReorganiseTileElements();
-            // This check is not expected to fail
-            freeElements = gameState.tileElements.capacity() - gameState.tileElements.size();
-            if (freeElements >= totalElementsRequired)
-            {
-                return true;
-            }
-        }
-
-        // Capacity must increase to handle the space (Note capacity can go above kMaxTileElements)
-        auto newCapacity = gameState.tileElements.capacity() * 2;
-        ReorganiseTileElements(newCapacity);
+        // Only the region that ran out of space needs compacting, elements on the rest of the map are left in place
+        CompactTileElementRegion(gameState, tilePos, totalElementsRequired);
         return true;
     }
 
@@ -285,7 +373,7 @@ namespace OpenRCT2
     bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements)
     {
         auto numElementsOnTile = CountElementsOnTile(loc);
-        return MapCheckFreeElementsAndReorganise(numElementsOnTile, numElements);
+        return MapCheckFreeElementsAndReorganise(TileCoordsXY(loc), numElementsOnTile, numElements);
     }
 
     static void ClearElementsAt(const CoordsXY& loc);
@@ -524,9 +612,12 @@ namespace OpenRCT2
     void MapStripGhostFlagFromElements()
     {
         auto& gameState = getGameState();
-        for (auto& element : gameState.tileElements)
+        for (auto& region : gameState.tileElementRegions)
         {
-            element.setGhost(false);
+            for (auto& element : region)
+            {
+                element.setGhost(false);
+            }
         }
     }
 
@@ -1008,11 +1099,6 @@ namespace OpenRCT2
         (tileElement - 1)->setLastForTile(true);
         tileElement->baseHeight = kMaxTileElementHeight;
         _tileElementsInUse--;
-        auto& gameState = getGameState();
-        if (tileElement == &gameState.tileElements.back())
-        {
-            gameState.tileElements.pop_back();
-        }
     }
 
     /**
@@ -1091,19 +1177,20 @@ namespace OpenRCT2
         return count;
     }
 
-    static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNewElements)
+    static TileElement* AllocateTileElements(const TileCoordsXY& tilePos, size_t numElementsOnTile, size_t numNewElements)
     {
-        if (!MapCheckFreeElementsAndReorganise(numElementsOnTile, numNewElements))
+        if (!MapCheckFreeElementsAndReorganise(tilePos, numElementsOnTile, numNewElements))
         {
             LOG_ERROR("Cannot insert new element");
             return nullptr;
         }
 
-        auto& gameState = getGameState();
-        auto oldSize = gameState.tileElements.size();
-        gameState.tileElements.resize(gameState.tileElements.size() + numElementsOnTile + numNewElements);
+        // The region has enough capacity at this point, so resizing does not move any existing elements
+        auto& region = getGameState().tileElementRegions[_tileIndex.GetRegionIndex(tilePos)];
+        auto oldSize = region.size();
+        region.resize(region.size() + numElementsOnTile + numNewElements);
         _tileElementsInUse += numNewElements;
-        return &gameState.tileElements[oldSize];
+        return &region[oldSize];
     }
 
     /**
@@ -1115,7 +1202,7 @@ namespace OpenRCT2
         const auto& tileLoc = TileCoordsXYZ(loc);
 
         auto numElementsOnTileOld = CountElementsOnTile(loc);
-        auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
+        auto* newTileElement = AllocateTileElements(tileLoc, numElementsOnTileOld, 1);
         auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
         if (newTileElement == nullptr)
         {
@@ -54,7 +54,7 @@ namespace OpenRCT2
     extern bool gMapLandRightsUpdateSuccess;
 
     void ReorganiseTileElements();
-    const std::vector<TileElement>& GetTileElements();
+    size_t GetTileElementCount();
     void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElements);
     void StashMap();
     void UnstashMap();
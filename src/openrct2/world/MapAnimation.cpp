@@ -13,6 +13,7 @@
 #include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../OpenRCT2.h"
 #include "../core/Numerics.hpp"
 #include "../entity/EntityList.h"
 #include "../entity/Peep.h"
@@ -37,7 +38,9 @@
 #include "tile_element/WallElement.h"
 
 #include <algorithm>
-#include <set>
+#include <array>
+#include <limits>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -54,6 +57,8 @@ struct TemporaryMapAnimation
         return std::tie(location.y, location.x, type, location.z)
             < std::tie(rhs.location.y, rhs.location.x, rhs.type, rhs.location.z);
     }
+
+    bool operator==(const TemporaryMapAnimation& rhs) const = default;
 };
 
 enum class UpdateType : uint8_t
@@ -71,11 +76,135 @@ struct TileCoordsXYCmp
     }
 };
 
-static std::vector<bool> _mapAnimationsInvalidate = std::vector<bool>(
-    kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, false);
-static std::set<TileCoordsXY, TileCoordsXYCmp> _mapAnimationsUpdate;
+namespace
+{
+    // The map is split into square chunks of tiles, each chunk holding one bit per tile. Each row of a chunk
+    // is a single word so that iterating a chunk visits tiles in the same order as the tile element storage.
+    constexpr int32_t kChunkShift = 5;
+    constexpr int32_t kChunkSize = 1 << kChunkShift;
+    constexpr int32_t kChunkMask = kChunkSize - 1;
+    constexpr int32_t kChunksPerSide = (kMaximumMapSizeTechnical + kChunkSize - 1) / kChunkSize;
+
+    struct TileChunk
+    {
+        std::array<uint32_t, kChunkSize> rows{};
+        uint16_t count{};
+    };
+
+    class TileBitmap
+    {
+    private:
+        std::array<TileChunk, kChunksPerSide * kChunksPerSide> _chunks{};
+
+    public:
+        static constexpr bool IsInRange(const TileCoordsXY coords) noexcept
+        {
+            return coords.x >= 0 && coords.y >= 0 && coords.x < kMaximumMapSizeTechnical
+                && coords.y < kMaximumMapSizeTechnical;
+        }
+
+        bool Test(const TileCoordsXY coords) const noexcept
+        {
+            const auto& chunk = _chunks[GetChunkIndex(coords)];
+            return (chunk.rows[coords.y & kChunkMask] & GetBit(coords)) != 0;
+        }
+
+        // Returns true if the bit was not already set.
+        bool Set(const TileCoordsXY coords) noexcept
+        {
+            auto& chunk = _chunks[GetChunkIndex(coords)];
+            auto& row = chunk.rows[coords.y & kChunkMask];
+            const auto bit = GetBit(coords);
+            if (row & bit)
+            {
+                return false;
+            }
+            row |= bit;
+            chunk.count++;
+            return true;
+        }
+
+        // Returns true if the bit was previously set.
+        bool Reset(const TileCoordsXY coords) noexcept
+        {
+            auto& chunk = _chunks[GetChunkIndex(coords)];
+            auto& row = chunk.rows[coords.y & kChunkMask];
+            const auto bit = GetBit(coords);
+            if (!(row & bit))
+            {
+                return false;
+            }
+            row &= ~bit;
+            chunk.count--;
+            return true;
+        }
+
+        void Clear() noexcept
+        {
+            _chunks.fill({});
+        }
+
+        bool IsChunkEmpty(const int32_t chunkX, const int32_t chunkY) const noexcept
+        {
+            return _chunks[chunkX + (chunkY * kChunksPerSide)].count == 0;
+        }
+
+        // Calls fn for every set tile of the chunk in memory order. The callback may reset the tile it is given.
+        template<typename TFn>
+        void ForEachInChunk(const int32_t chunkX, const int32_t chunkY, TFn&& fn)
+        {
+            const auto& chunk = _chunks[chunkX + (chunkY * kChunksPerSide)];
+            for (int32_t row = 0; row < kChunkSize && chunk.count != 0; row++)
+            {
+                auto bits = chunk.rows[row];
+                while (bits != 0)
+                {
+                    const auto bitIndex = Numerics::bitScanForward(bits);
+                    bits &= bits - 1;
+                    fn(TileCoordsXY{ (chunkX << kChunkShift) + bitIndex, (chunkY << kChunkShift) + row });
+                }
+            }
+        }
+
+        template<typename TFn>
+        void ForEach(TFn&& fn)
+        {
+            for (int32_t chunkY = 0; chunkY < kChunksPerSide; chunkY++)
+            {
+                for (int32_t chunkX = 0; chunkX < kChunksPerSide; chunkX++)
+                {
+                    if (!IsChunkEmpty(chunkX, chunkY))
+                    {
+                        ForEachInChunk(chunkX, chunkY, fn);
+                    }
+                }
+            }
+        }
+
+    private:
+        static constexpr size_t GetChunkIndex(const TileCoordsXY coords) noexcept
+        {
+            return (coords.x >> kChunkShift) + ((coords.y >> kChunkShift) * kChunksPerSide);
+        }
+
+        static constexpr uint32_t GetBit(const TileCoordsXY coords) noexcept
+        {
+            return 1u << (coords.x & kChunkMask);
+        }
+    };
+} // namespace
+
+// Tiles that only need to be redrawn while on screen.
+static TileBitmap _mapAnimationsInvalidate;
 
-static std::set<TemporaryMapAnimation> _temporaryMapAnimations;
+// Tiles that need to be updated every other tick regardless of visibility, kept as a dense list sorted in memory
+// order. New tiles are collected in a pending list and merged in before the next update.
+static TileBitmap _mapAnimationsUpdateMembers;
+static std::vector<TileCoordsXY> _mapAnimationsUpdate;
+static std::vector<TileCoordsXY> _mapAnimationsUpdatePending;
+
+// Sorted and free of duplicates.
+static std::vector<TemporaryMapAnimation> _temporaryMapAnimations;
 
 template<bool invalidateAllViewports>
 static void Invalidate(
@@ -599,9 +728,9 @@ static std::optional<UpdateType> IsElementAnimated(const TileElementBase& elemen
 
 void MapAnimations::MarkTileForInvalidation(const TileCoordsXY coords)
 {
-    if (!MapIsEdge(coords.ToCoordsXY()) && !_mapAnimationsUpdate.contains(coords))
+    if (isPresentationEnabled() && !MapIsEdge(coords.ToCoordsXY()) && !_mapAnimationsUpdateMembers.Test(coords))
     {
-        _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = true;
+        _mapAnimationsInvalidate.Set(coords);
     }
 }
 
@@ -609,38 +738,95 @@ void MapAnimations::MarkTileForUpdate(const TileCoordsXY coords)
 {
     if (!MapIsEdge(coords.ToCoordsXY()))
     {
-        _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = false;
-        _mapAnimationsUpdate.insert(coords);
+        _mapAnimationsInvalidate.Reset(coords);
+        if (_mapAnimationsUpdateMembers.Set(coords))
+        {
+            _mapAnimationsUpdatePending.push_back(coords);
+        }
     }
 }
 
 void MapAnimations::CreateTemporary(const CoordsXYZ& coords, const TemporaryType type)
 {
-    _temporaryMapAnimations.insert(TemporaryMapAnimation{ coords, type });
+    const TemporaryMapAnimation animation{ coords, type };
+    const auto it = std::lower_bound(_temporaryMapAnimations.begin(), _temporaryMapAnimations.end(), animation);
+    if (it == _temporaryMapAnimations.end() || !(*it == animation))
+    {
+        _temporaryMapAnimations.insert(it, animation);
+    }
 }
 
 void MapAnimations::MarkAllTiles()
 {
-    TileElementIterator it;
-    TileElementIteratorBegin(&it);
-    while (TileElementIteratorNext(&it))
+    // Walk the tiles in memory order, edge tiles can not hold animations.
+    const auto mapSize = getGameState().mapSize;
+    for (int32_t y = 1; y < mapSize.y - 1; y++)
     {
-        const auto isAnimated = IsElementAnimated(*it.element);
-        if (isAnimated)
+        for (int32_t x = 1; x < mapSize.x - 1; x++)
         {
-            switch (*isAnimated)
+            const TileCoordsXY coords{ x, y };
+            const auto* tileElement = MapGetFirstElementAt(coords);
+            if (tileElement == nullptr)
             {
-                case UpdateType::invalidate:
-                    MarkTileForInvalidation(TileCoordsXY(it.x, it.y));
-                    break;
-                case UpdateType::update:
-                    MarkTileForUpdate(TileCoordsXY(it.x, it.y));
-                    break;
+                continue;
             }
+
+            do
+            {
+                const auto isAnimated = IsElementAnimated(*tileElement);
+                if (isAnimated)
+                {
+                    switch (*isAnimated)
+                    {
+                        case UpdateType::invalidate:
+                            MarkTileForInvalidation(coords);
+                            break;
+                        case UpdateType::update:
+                            MarkTileForUpdate(coords);
+                            break;
+                    }
+                }
+            } while (!(tileElement++)->isLastForTile());
         }
     }
 }
 
+static bool IsChunkVisible(const Viewport& viewport, const int32_t chunkX, const int32_t chunkY)
+{
+    const CoordsXY chunkStart = TileCoordsXY{ chunkX << kChunkShift, chunkY << kChunkShift }.ToCoordsXY();
+    const CoordsXY chunkEnd = chunkStart + CoordsXY{ kChunkSize * kCoordsXYStep, kChunkSize * kCoordsXYStep };
+    const std::array<CoordsXY, 4> corners = {
+        chunkStart,
+        CoordsXY{ chunkEnd.x, chunkStart.y },
+        CoordsXY{ chunkStart.x, chunkEnd.y },
+        chunkEnd,
+    };
+
+    auto left = std::numeric_limits<int32_t>::max();
+    auto top = std::numeric_limits<int32_t>::max();
+    auto right = std::numeric_limits<int32_t>::min();
+    auto bottom = std::numeric_limits<int32_t>::min();
+    for (const auto& corner : corners)
+    {
+        const auto screenPos = Translate3DTo2DWithZ(viewport.rotation, CoordsXYZ{ corner, 0 });
+        left = std::min(left, screenPos.x);
+        top = std::min(top, screenPos.y);
+        right = std::max(right, screenPos.x);
+        bottom = std::max(bottom, screenPos.y);
+    }
+
+    // Same margins as Viewport::ContainsTile.
+    left -= kScreenCoordsTileWidthHalf;
+    right += kScreenCoordsTileWidthHalf;
+    top -= (kMaxTileElementHeight * kCoordsZStep) + kScreenCoordsTileHeightHalf;
+    bottom += kScreenCoordsTileHeightHalf;
+
+    const auto& viewPos = viewport.viewPos;
+    return !(
+        left > viewPos.x + viewport.ViewWidth() || top > viewPos.y + viewport.ViewHeight() || right < viewPos.x
+        || bottom < viewPos.y);
+}
+
 static void InvalidateAll(const ViewportList& viewports)
 {
     for (const auto* const viewport : viewports)
@@ -650,41 +836,27 @@ static void InvalidateAll(const ViewportList& viewports)
             continue;
         }
 
-        // Code adapted from PaintSessionGenerateRotate.
-        // Ideally this would iterate over tiles in memory order.
-        constexpr int32_t maxTileHeightModifier = 88; // from magic value in PaintSessionGenerateRotate
-        constexpr int32_t maxTileHeight = (kMaxTileElementHeight * kCoordsZStep) + maxTileHeightModifier;
-
-        const auto direction = DirectionFlipXAxis(viewport->rotation);
-        const int32_t numVerticalTiles = (viewport->ViewHeight() + maxTileHeight) / kScreenCoordsTileHeight;
-        const TileCoordsXY nextVerticalTile = TileCoordsXY{ 1, 1 }.Rotate(direction);
-        const int32_t screenCoordY = Numerics::floor2(
-            (viewport->viewPos.y - kScreenCoordsTileHeightHalf), kScreenCoordsTileWidthHalf);
-
-        for (int32_t x = viewport->viewPos.x; x < viewport->viewPos.x + viewport->ViewWidth() + kScreenCoordsTileWidth;
-             x += kScreenCoordsTileWidthHalf)
+        // Cull whole chunks first, then the individual tiles of the chunks that are on screen.
+        for (int32_t chunkY = 0; chunkY < kChunksPerSide; chunkY++)
         {
-            const ScreenCoordsXY screenCoord = { Numerics::floor2(x, kScreenCoordsTileWidthHalf), screenCoordY };
-            CoordsXY mapTile = { screenCoord.y - screenCoord.x / 2, screenCoord.y + screenCoord.x / 2 };
-            mapTile = mapTile.Rotate(direction);
-            if (direction & 1)
+            for (int32_t chunkX = 0; chunkX < kChunksPerSide; chunkX++)
             {
-                mapTile.y -= kCoordsXYHalfTile;
-            }
-            mapTile = mapTile.ToTileStart();
-            TileCoordsXY tileCoords(mapTile);
-
-            for (int32_t i = 0; i < numVerticalTiles; ++i)
-            {
-                if (!MapIsEdge(tileCoords.ToCoordsXY())
-                    && _mapAnimationsInvalidate[tileCoords.x + (tileCoords.y * kMaximumMapSizeTechnical)])
+                if (_mapAnimationsInvalidate.IsChunkEmpty(chunkX, chunkY) || !IsChunkVisible(*viewport, chunkX, chunkY))
                 {
-                    if (!UpdateTile<true, false>(tileCoords, viewport))
+                    continue;
+                }
+
+                _mapAnimationsInvalidate.ForEachInChunk(chunkX, chunkY, [viewport](const TileCoordsXY tileCoords) {
+                    if (MapIsEdge(tileCoords.ToCoordsXY()))
                     {
-                        _mapAnimationsInvalidate[tileCoords.x + (tileCoords.y * kMaximumMapSizeTechnical)] = false;
+                        _mapAnimationsInvalidate.Reset(tileCoords);
+                        return;
                     }
-                }
-                tileCoords += nextVerticalTile;
+                    if (viewport->ContainsTile(tileCoords) && !UpdateTile<true, false>(tileCoords, viewport))
+                    {
+                        _mapAnimationsInvalidate.Reset(tileCoords);
+                    }
+                });
             }
         }
     }
@@ -702,60 +874,81 @@ static bool IsTileVisible(const ViewportList& viewports, const TileCoordsXY tile
     return false;
 }
 
+static void MergePendingUpdates()
+{
+    if (_mapAnimationsUpdatePending.empty())
+    {
+        return;
+    }
+
+    std::sort(_mapAnimationsUpdatePending.begin(), _mapAnimationsUpdatePending.end(), TileCoordsXYCmp{});
+    const auto oldSize = static_cast<std::ptrdiff_t>(_mapAnimationsUpdate.size());
+    _mapAnimationsUpdate.insert(
+        _mapAnimationsUpdate.end(), _mapAnimationsUpdatePending.begin(), _mapAnimationsUpdatePending.end());
+    std::inplace_merge(
+        _mapAnimationsUpdate.begin(), _mapAnimationsUpdate.begin() + oldSize, _mapAnimationsUpdate.end(), TileCoordsXYCmp{});
+    _mapAnimationsUpdatePending.clear();
+}
+
 static void UpdateAll(const ViewportList& viewports)
 {
     // Currently nothing updates on odd ticks.
     if (getGameState().currentTicks & 1)
         return;
 
-    auto it = _mapAnimationsUpdate.begin();
-    while (it != _mapAnimationsUpdate.end())
+    MergePendingUpdates();
+
+    // Compact the list in place, tiles that stopped animating are dropped or moved to the invalidation bitmap.
+    size_t numKept = 0;
+    for (size_t i = 0; i < _mapAnimationsUpdate.size(); i++)
     {
-        const bool isVisible = IsTileVisible(viewports, *it);
-        const auto result = isVisible ? UpdateTile<true, true>(*it, nullptr) : UpdateTile<false, true>(*it, nullptr);
-        if (result)
+        const auto coords = _mapAnimationsUpdate[i];
+        const bool isVisible = IsTileVisible(viewports, coords);
+        const auto result = isVisible ? UpdateTile<true, true>(coords, nullptr) : UpdateTile<false, true>(coords, nullptr);
+        if (result && result.value() == UpdateType::update)
         {
-            if (result.value() == UpdateType::invalidate)
-            {
-                const auto& coords = *it;
-                _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = true;
-                it = _mapAnimationsUpdate.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            _mapAnimationsUpdate[numKept++] = coords;
+            continue;
         }
-        else
+
+        _mapAnimationsUpdateMembers.Reset(coords);
+        if (result && isPresentationEnabled())
         {
-            it = _mapAnimationsUpdate.erase(it);
+            _mapAnimationsInvalidate.Set(coords);
         }
     }
+    _mapAnimationsUpdate.resize(numKept);
 }
 
 static void UpdateAllTemporary(const ViewportList& viewports)
 {
-    auto it = _temporaryMapAnimations.begin();
-    while (it != _temporaryMapAnimations.end())
+    size_t numKept = 0;
+    for (size_t i = 0; i < _temporaryMapAnimations.size(); i++)
     {
-        const auto& animation = *it;
+        const auto animation = _temporaryMapAnimations[i];
         const bool isVisible = IsTileVisible(viewports, TileCoordsXY(animation.location));
-        const auto result = isVisible ? UpdateTemporaryAnimation<true>(*it) : UpdateTemporaryAnimation<false>(*it);
+        const auto result = isVisible ? UpdateTemporaryAnimation<true>(animation) : UpdateTemporaryAnimation<false>(animation);
         if (result)
         {
-            ++it;
-        }
-        else
-        {
-            it = _temporaryMapAnimations.erase(it);
+            _temporaryMapAnimations[numKept++] = animation;
         }
     }
+    _temporaryMapAnimations.resize(numKept);
 }
 
 void MapAnimations::InvalidateAndUpdateAll()
 {
     PROFILED_FUNCTION();
 
+    if (!isPresentationEnabled())
+    {
+        // Only tiles that change the game state need visiting.
+        const ViewportList noViewports{};
+        UpdateAll(noViewports);
+        UpdateAllTemporary(noViewports);
+        return;
+    }
+
     const auto viewports = GetVisibleViewports();
     InvalidateAll(viewports);
     UpdateAll(viewports);
@@ -764,8 +957,10 @@ void MapAnimations::InvalidateAndUpdateAll()
 
 void MapAnimations::ClearAll()
 {
-    _mapAnimationsInvalidate.assign(_mapAnimationsInvalidate.size(), false);
+    _mapAnimationsInvalidate.Clear();
+    _mapAnimationsUpdateMembers.Clear();
     _mapAnimationsUpdate.clear();
+    _mapAnimationsUpdatePending.clear();
     _temporaryMapAnimations.clear();
 }
 
@@ -774,32 +969,35 @@ void MapAnimations::ShiftAll(const TileCoordsXY amount)
     if (amount.x == 0 && amount.y == 0)
         return;
 
-    std::vector<bool> newMapAnimationsInvalidate(_mapAnimationsInvalidate.size(), false);
-    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+    std::vector<TileCoordsXY> invalidateTiles;
+    _mapAnimationsInvalidate.ForEach([&invalidateTiles](const TileCoordsXY coords) { invalidateTiles.push_back(coords); });
+    _mapAnimationsInvalidate.Clear();
+    for (const auto coords : invalidateTiles)
     {
-        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        const TileCoordsXY newCoords = coords + amount;
+        if (!MapIsEdge(newCoords.ToCoordsXY()))
         {
-            const bool animated = _mapAnimationsInvalidate[x + (y * kMaximumMapSizeTechnical)];
-            const TileCoordsXY newCoords = TileCoordsXY(x, y) + amount;
-            if (!MapIsEdge(newCoords.ToCoordsXY()))
-            {
-                newMapAnimationsInvalidate[newCoords.x + (newCoords.y * kMaximumMapSizeTechnical)] = animated;
-            }
+            _mapAnimationsInvalidate.Set(newCoords);
         }
     }
-    _mapAnimationsInvalidate = std::move(newMapAnimationsInvalidate);
 
-    std::set<TileCoordsXY, TileCoordsXYCmp> newMapAnimationsUpdate;
-    for (const auto a : _mapAnimationsUpdate)
+    // Translating every tile by the same amount keeps the list sorted.
+    MergePendingUpdates();
+    _mapAnimationsUpdateMembers.Clear();
+    size_t numKept = 0;
+    for (size_t i = 0; i < _mapAnimationsUpdate.size(); i++)
     {
-        newMapAnimationsUpdate.insert(a + amount);
+        const TileCoordsXY newCoords = _mapAnimationsUpdate[i] + amount;
+        if (TileBitmap::IsInRange(newCoords))
+        {
+            _mapAnimationsUpdateMembers.Set(newCoords);
+            _mapAnimationsUpdate[numKept++] = newCoords;
+        }
     }
-    _mapAnimationsUpdate = std::move(newMapAnimationsUpdate);
+    _mapAnimationsUpdate.resize(numKept);
 
-    std::set<TemporaryMapAnimation> newTemporaryMapAnimations;
-    for (const auto& a : _temporaryMapAnimations)
+    for (auto& a : _temporaryMapAnimations)
     {
-        newTemporaryMapAnimations.insert(TemporaryMapAnimation{ a.location + CoordsXYZ(amount.ToCoordsXY(), 0), a.type });
+        a.location += CoordsXYZ(amount.ToCoordsXY(), 0);
     }
-    _temporaryMapAnimations = std::move(newTemporaryMapAnimations);
 }
@@ -352,6 +352,7 @@ namespace OpenRCT2::TileInspector
             pastedElement->setLastForTile(lastForTile);
 
             MapAnimations::MarkTileForUpdate(tileLoc);
+            FootpathBinIndexMarkTile(loc);
 
             if (IsTileSelected(loc))
             {
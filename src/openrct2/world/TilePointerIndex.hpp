@@ -22,8 +22,17 @@ class TilePointerIndex
     uint16_t MapSize{};
 
 public:
+    // Tiles are grouped into square regions so that element storage can be managed per region.
+    static constexpr int32_t kRegionSize = 32;
+
     TilePointerIndex() = default;
 
+    explicit TilePointerIndex(const uint16_t mapSize)
+        : TilePointers(mapSize * mapSize)
+        , MapSize(mapSize)
+    {
+    }
+
     explicit TilePointerIndex(const uint16_t mapSize, T* tileElements, size_t count)
     {
         MapSize = mapSize;
@@ -53,4 +62,20 @@ public:
     {
         TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
     }
+
+    size_t GetRegionCount() const
+    {
+        return GetRegionsPerRow() * GetRegionsPerRow();
+    }
+
+    size_t GetRegionIndex(TileCoordsXY coords) const
+    {
+        return (coords.x / kRegionSize) + ((coords.y / kRegionSize) * GetRegionsPerRow());
+    }
+
+private:
+    size_t GetRegionsPerRow() const
+    {
+        return (MapSize + kRegionSize - 1) / kRegionSize;
+    }
 };
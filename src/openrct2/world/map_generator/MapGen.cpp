@@ -22,6 +22,7 @@
 #include "SurfaceSelection.h"
 #include "TreePlacement.h"
 
+#include <random>
 #include <vector>
 
 namespace OpenRCT2::World::MapGenerator
@@ -30,8 +31,24 @@ namespace OpenRCT2::World::MapGenerator
 
     static void addBeaches(Settings* settings);
 
+    // Separate from UtilRand so that the same seed always generates the same map
+    static std::mt19937 _prng;
+
+    uint32_t generatorRand()
+    {
+        return _prng();
+    }
+
+    float generatorRandNormalDistributed()
+    {
+        std::normal_distribution<float> distributor(0.0f, 1.0f);
+        return distributor(_prng);
+    }
+
     void generate(Settings* settings)
     {
+        _prng.seed(settings->seed != 0 ? settings->seed : UtilRand());
+
         // First, generate the height map
         switch (settings->algorithm)
         {
@@ -31,6 +31,7 @@ namespace OpenRCT2::World::MapGenerator
         int32_t heightmapLow = 14;
         int32_t heightmapHigh = 60;
         bool smoothTileEdges = true;
+        uint32_t seed = 0; // A random seed is used when zero
 
         // Features (e.g. tree, rivers, lakes etc.)
         bool trees = true;
@@ -52,6 +53,8 @@ namespace OpenRCT2::World::MapGenerator
     class HeightMap;
 
     void generate(Settings* settings);
+    uint32_t generatorRand();
+    float generatorRandNormalDistributed();
     void resetSurfaces(Settings* settings);
     void setWaterLevel(int32_t waterLevel);
     void setMapHeight(Settings* settings, const HeightMap& heightMap);
@@ -9,12 +9,16 @@
 
 #include "SimplexNoise.h"
 
-#include "../../util/Util.h"
+#include "../../config/Config.h"
+#include "../../core/JobPool.h"
 #include "HeightMap.hpp"
 #include "MapGen.h"
 #include "MapHelpers.h"
 
 #include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace OpenRCT2::World::MapGenerator
 {
@@ -35,7 +39,7 @@ namespace OpenRCT2::World::MapGenerator
     {
         for (auto& i : perm)
         {
-            i = UtilRand() & 0xFF;
+            i = generatorRand() & 0xFF;
         }
     }
 
@@ -151,34 +155,75 @@ namespace OpenRCT2::World::MapGenerator
         return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
     }
 
+    static constexpr int32_t kRowsPerJob = 32;
+
     /**
-     * Smooths the height map.
+     * Splits the rows of the height map into bands and runs the given function on each of them, on the job pool if
+     * there is one. Bands must only write to their own rows so that the result does not depend on the thread count.
      */
-    static void smoothHeightMap(int32_t iterations, HeightMap& heightMap)
+    template<typename TFn>
+    static void forEachRowBand(JobPool* jobs, int32_t numRows, TFn&& fn)
     {
-        for (auto i = 0; i < iterations; i++)
+        if (jobs == nullptr || numRows <= kRowsPerJob)
+        {
+            fn(0, numRows);
+            return;
+        }
+
+        for (int32_t startY = 0; startY < numRows; startY += kRowsPerJob)
         {
-            auto copyHeight = heightMap;
-            for (auto y = 1; y < heightMap.height - 1; y++)
+            const auto endY = std::min(startY + kRowsPerJob, numRows);
+            jobs->AddTask([&fn, startY, endY]() -> void { fn(startY, endY); });
+        }
+        jobs->Join();
+    }
+
+    /**
+     * Applies a 3x3 box blur to the rows [startY, endY) of src, writing the result to dst. Done as a vertical pass into
+     * a row of column sums followed by a horizontal pass, both of which are simple enough for the compiler to vectorise.
+     */
+    static void smoothHeightMapRows(const HeightMap& src, HeightMap& dst, int32_t startY, int32_t endY)
+    {
+        const auto width = src.width;
+        std::vector<uint16_t> columnSums(width);
+
+        startY = std::max(startY, 1);
+        endY = std::min(endY, src.height - 1);
+        for (auto y = startY; y < endY; y++)
+        {
+            const auto* above = src.data() + (y - 1) * width;
+            const auto* row = src.data() + y * width;
+            const auto* below = src.data() + (y + 1) * width;
+            for (auto x = 0; x < width; x++)
             {
-                for (auto x = 1; x < heightMap.width - 1; x++)
-                {
-                    auto avg = 0;
-                    for (auto yy = -1; yy <= 1; yy++)
-                    {
-                        for (auto xx = -1; xx <= 1; xx++)
-                        {
-                            avg += copyHeight[{ y + yy, x + xx }];
-                        }
-                    }
-                    avg /= 9;
-                    heightMap[{ x, y }] = avg;
-                }
+                columnSums[x] = above[x] + row[x] + below[x];
             }
+
+            auto* dstRow = dst.data() + y * width;
+            for (auto x = 1; x < width - 1; x++)
+            {
+                dstRow[x] = static_cast<uint8_t>((columnSums[x - 1] + columnSums[x] + columnSums[x + 1]) / 9);
+            }
+        }
+    }
+
+    /**
+     * Smooths the height map, leaving the outer rows and columns as they are.
+     */
+    static void smoothHeightMap(JobPool* jobs, int32_t iterations, HeightMap& heightMap)
+    {
+        // Edges are never written, so both buffers keep the same edges while swapping between them
+        auto smoothed = heightMap;
+        for (auto i = 0; i < iterations; i++)
+        {
+            forEachRowBand(jobs, heightMap.height, [&](int32_t startY, int32_t endY) {
+                smoothHeightMapRows(heightMap, smoothed, startY, endY);
+            });
+            std::swap(heightMap, smoothed);
         }
     }
 
-    static void generateSimplexNoise(Settings* settings, HeightMap& heightMap)
+    static void generateSimplexNoise(JobPool* jobs, Settings* settings, HeightMap& heightMap)
     {
         float freq = settings->simplex_base_freq / 100.0f * (1.0f / heightMap.width);
         int32_t octaves = settings->simplex_octaves;
@@ -187,16 +232,18 @@ namespace OpenRCT2::World::MapGenerator
         int32_t high = settings->heightmapHigh / 2 - low;
 
         NoiseRand();
-        for (int32_t y = 0; y < heightMap.height; y++)
-        {
-            for (int32_t x = 0; x < heightMap.width; x++)
+        forEachRowBand(jobs, heightMap.height, [&](int32_t startY, int32_t endY) {
+            for (int32_t y = startY; y < endY; y++)
             {
-                float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
-                float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+                for (int32_t x = 0; x < heightMap.width; x++)
+                {
+                    float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+                    float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
-                heightMap[{ x, y }] = low + static_cast<int32_t>(normalisedNoiseValue * high);
+                    heightMap[{ x, y }] = low + static_cast<int32_t>(normalisedNoiseValue * high);
+                }
             }
-        }
+        });
     }
 
     void generateSimplexMap(Settings* settings)
@@ -208,8 +255,14 @@ namespace OpenRCT2::World::MapGenerator
         const auto density = 2;
         auto heightMap = HeightMap(mapSize.x, mapSize.y, density);
 
-        generateSimplexNoise(settings, heightMap);
-        smoothHeightMap(2 + (UtilRand() % 6), heightMap);
+        std::unique_ptr<JobPool> jobs;
+        if (Config::Get().general.multiThreading)
+        {
+            jobs = std::make_unique<JobPool>();
+        }
+
+        generateSimplexNoise(jobs.get(), settings, heightMap);
+        smoothHeightMap(jobs.get(), 2 + (generatorRand() % 6), heightMap);
 
         // Set the game map to the height map
         setMapHeight(settings, heightMap);
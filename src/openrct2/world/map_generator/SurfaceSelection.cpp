@@ -15,7 +15,6 @@
 #include "../../object/ObjectManager.h"
 #include "../../object/TerrainEdgeObject.h"
 #include "../../object/TerrainSurfaceObject.h"
-#include "../../util/Util.h"
 #include "MapGen.h"
 
 #include <algorithm>
@@ -47,7 +46,7 @@ namespace OpenRCT2::World::MapGenerator
                 // Fall back to the first available surface texture that is available in the park
                 surfaceTexture = TerrainSurfaceObject::GetById(0)->GetIdentifier();
             else
-                surfaceTexture = availableTerrains[UtilRand() % availableTerrains.size()];
+                surfaceTexture = availableTerrains[generatorRand() % availableTerrains.size()];
         }
 
         auto surfaceTextureId = objectManager.GetLoadedObjectEntryIndex(ObjectEntryDescriptor(surfaceTexture));
@@ -97,7 +96,7 @@ namespace OpenRCT2::World::MapGenerator
         if (availableBeachTextures.empty())
             return kObjectEntryIndexNull;
 
-        std::string_view beachTexture = availableBeachTextures[UtilRand() % availableBeachTextures.size()];
+        std::string_view beachTexture = availableBeachTextures[generatorRand() % availableBeachTextures.size()];
         return objectManager.GetLoadedObjectEntryIndex(ObjectEntryDescriptor(beachTexture));
     }
 } // namespace OpenRCT2::World::MapGenerator
@@ -16,7 +16,6 @@
 #include "../../object/ObjectManager.h"
 #include "../../object/SmallSceneryEntry.h"
 #include "../../object/TerrainSurfaceObject.h"
-#include "../../util/Util.h"
 #include "../Map.h"
 #include "../tile_element/SmallSceneryElement.h"
 #include "../tile_element/SurfaceElement.h"
@@ -76,7 +75,7 @@ namespace OpenRCT2::World::MapGenerator
         Guard::Assert(sceneryElement != nullptr);
 
         sceneryElement->setClearanceZ(surfaceZ + sceneryEntry->height);
-        sceneryElement->setDirection(UtilRand() & 3);
+        sceneryElement->setDirection(generatorRand() & 3);
         sceneryElement->SetEntryIndex(type);
         sceneryElement->SetAge(0);
         sceneryElement->SetPrimaryColour(Drawing::Colour::yellow);
@@ -201,27 +200,27 @@ namespace OpenRCT2::World::MapGenerator
 
                 // Use tree:land ratio except when near an oasis
                 constexpr static auto randModulo = 0xFFFF;
-                if (static_cast<float>(UtilRand() & randModulo) / randModulo > std::max(treeToLandRatio, oasisScore))
+                if (static_cast<float>(generatorRand() & randModulo) / randModulo > std::max(treeToLandRatio, oasisScore))
                     continue;
 
                 // Use fractal noise to group tiles that are likely to spawn trees together
                 float noiseValue = FractalNoise(x, y, 0.025f, 2, 2.0f, 0.65f);
                 // Reduces the range to rarely stray further than 0.5 from the mean.
-                float noiseOffset = UtilRandNormalDistributed() * 0.25f;
+                float noiseOffset = generatorRandNormalDistributed() * 0.25f;
                 if (noiseValue + oasisScore < noiseOffset)
                     continue;
 
                 if (!grassTreeIds.empty() && surfaceTakesGrassTrees(surfaceStyleObject))
                 {
-                    treeObjectEntryIndex = grassTreeIds[UtilRand() % grassTreeIds.size()];
+                    treeObjectEntryIndex = grassTreeIds[generatorRand() % grassTreeIds.size()];
                 }
                 else if (!desertTreeIds.empty() && surfaceTakesSandTrees(surfaceStyleObject))
                 {
-                    treeObjectEntryIndex = desertTreeIds[UtilRand() % desertTreeIds.size()];
+                    treeObjectEntryIndex = desertTreeIds[generatorRand() % desertTreeIds.size()];
                 }
                 else if (!snowTreeIds.empty() && surfaceTakesSnowTrees(surfaceStyleObject))
                 {
-                    treeObjectEntryIndex = snowTreeIds[UtilRand() % snowTreeIds.size()];
+                    treeObjectEntryIndex = snowTreeIds[generatorRand() % snowTreeIds.size()];
                 }
 
                 if (treeObjectEntryIndex != kObjectEntryIndexNull)
@@ -0,0 +1,215 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <openrct2/audio/AudioMixing.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2::Audio;
+
+namespace
+{
+    constexpr int32_t kMaxVolume = 128;
+
+    struct MixCase
+    {
+        int32_t srcFrames;
+        int32_t dstFrames;
+        double ratio;
+        // Old and new pan gains, no panning if both are 1.
+        float oldPanLeft;
+        float oldPanRight;
+        float panLeft;
+        float panRight;
+        int32_t startVolume;
+        int32_t endVolume;
+    };
+} // namespace
+
+class AudioMixingTests : public testing::Test
+{
+protected:
+    std::mt19937 _random{ 1234 };
+
+    std::vector<int16_t> RandomSamples(size_t count, int32_t amplitude)
+    {
+        std::uniform_int_distribution<int32_t> dist(-amplitude, amplitude);
+        std::vector<int16_t> result(count);
+        for (auto& value : result)
+            value = static_cast<int16_t>(std::clamp(dist(_random), -32768, 32767));
+        return result;
+    }
+
+    // The gains AudioMixer::MixChannelS16Stereo passes to the kernel.
+    static MixGains GetGains(const MixCase& mixCase)
+    {
+        MixGains gains{ 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        if (mixCase.oldPanLeft != 1.0f || mixCase.oldPanRight != 1.0f || mixCase.panLeft != 1.0f
+            || mixCase.panRight != 1.0f)
+        {
+            const float dt = 1.0f / static_cast<float>(mixCase.dstFrames * 2.0f);
+            gains.panLeft = mixCase.oldPanLeft;
+            gains.panRight = mixCase.oldPanRight;
+            gains.panLeftStep = dt * (mixCase.panLeft - mixCase.oldPanLeft);
+            gains.panRightStep = dt * (mixCase.panRight - mixCase.oldPanRight);
+        }
+        if (mixCase.startVolume != mixCase.endVolume)
+        {
+            gains.volume = static_cast<float>(mixCase.startVolume) / kMaxVolume;
+            gains.volumeStep = static_cast<float>(mixCase.endVolume - mixCase.startVolume) / kMaxVolume
+                / (mixCase.dstFrames * 2);
+        }
+        else
+        {
+            gains.volume = static_cast<float>(mixCase.endVolume) / kMaxVolume;
+        }
+        return gains;
+    }
+
+    // The separate passes the mixer used before: ApplyResample, EffectPanS16, EffectFadeS16 and SDL_MixAudioFormat.
+    static void MixWithSeparatePasses(int16_t* dst, const int16_t* src, const MixCase& mixCase)
+    {
+        const auto length = mixCase.dstFrames;
+        std::vector<int16_t> buffer(length * 2);
+        for (int32_t i = 0; i < length; i++)
+        {
+            double srcPos = i * mixCase.ratio;
+            int32_t index = static_cast<int32_t>(srcPos);
+            double frac = srcPos - index;
+            if (index >= mixCase.srcFrames - 1)
+            {
+                index = mixCase.srcFrames - 2;
+                frac = 1.0;
+            }
+            for (int32_t ch = 0; ch < 2; ch++)
+            {
+                const double sample = (1.0 - frac) * src[index * 2 + ch] + frac * src[index * 2 + 2 + ch];
+                buffer[i * 2 + ch] = static_cast<int16_t>(std::clamp(sample, -32768.0, 32767.0));
+            }
+        }
+
+        const auto gains = GetGains(mixCase);
+        if (gains.panLeftStep != 0.0f || gains.panRightStep != 0.0f || gains.panLeft != 1.0f || gains.panRight != 1.0f)
+        {
+            float volumeL = gains.panLeft;
+            float volumeR = gains.panRight;
+            for (int32_t i = 0; i < length * 2; i += 2)
+            {
+                buffer[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(buffer[i + 0]));
+                buffer[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(buffer[i + 1]));
+                volumeL += gains.panLeftStep;
+                volumeR += gains.panRightStep;
+            }
+        }
+
+        int32_t mixVolume = mixCase.endVolume;
+        if (mixCase.startVolume != mixCase.endVolume)
+        {
+            mixVolume = kMaxVolume;
+            const float startVolume = static_cast<float>(mixCase.startVolume) / kMaxVolume;
+            const float endVolume = static_cast<float>(mixCase.endVolume) / kMaxVolume;
+            const int32_t fadeLength = length * 2;
+            for (int32_t i = 0; i < fadeLength; i++)
+            {
+                const float t = static_cast<float>(i) / fadeLength;
+                buffer[i] = static_cast<int16_t>(buffer[i] * ((1.0f - t) * startVolume + t * endVolume));
+            }
+        }
+
+        for (int32_t i = 0; i < length * 2; i++)
+        {
+            const int32_t sample = buffer[i] * mixVolume / kMaxVolume;
+            dst[i] = static_cast<int16_t>(std::clamp(dst[i] + sample, -32768, 32767));
+        }
+    }
+
+    static std::vector<MixCase> GetCases()
+    {
+        std::vector<MixCase> cases;
+        // Playback rates as used for ride music and sound effects, including chunks that are not a multiple of four.
+        const std::pair<int32_t, int32_t> frameCounts[] = { { 2048, 2048 }, { 1536, 2048 }, { 3072, 2048 },
+                                                            { 1023, 1023 }, { 3, 7 },       { 2, 5 } };
+        for (const auto& [srcFrames, dstFrames] : frameCounts)
+        {
+            const double ratio = static_cast<double>(srcFrames) / dstFrames;
+            // Centred, a ramp between two pans and a hard pan.
+            cases.push_back({ srcFrames, dstFrames, ratio, 1.0f, 1.0f, 1.0f, 1.0f, 100, 100 });
+            cases.push_back({ srcFrames, dstFrames, ratio, 1.0f, 0.2f, 0.3f, 0.9f, 100, 100 });
+            cases.push_back({ srcFrames, dstFrames, ratio, 0.0f, 1.0f, 0.0f, 1.0f, 128, 128 });
+            // Fading in and out.
+            cases.push_back({ srcFrames, dstFrames, ratio, 1.0f, 1.0f, 1.0f, 1.0f, 0, 128 });
+            cases.push_back({ srcFrames, dstFrames, ratio, 0.8f, 0.4f, 0.6f, 0.7f, 128, 0 });
+        }
+        return cases;
+    }
+};
+
+TEST_F(AudioMixingTests, KernelMatchesScalar)
+{
+    for (const auto& mixCase : GetCases())
+    {
+        for (int32_t amplitude : { 1000, 32768 })
+        {
+            const auto src = RandomSamples(mixCase.srcFrames * 2, amplitude);
+            const auto initial = RandomSamples(mixCase.dstFrames * 2, amplitude);
+            const auto gains = GetGains(mixCase);
+
+            auto expected = initial;
+            auto actual = initial;
+            MixResampledS16StereoScalar(
+                expected.data(), mixCase.dstFrames, src.data(), mixCase.srcFrames, mixCase.ratio, gains);
+            MixResampledS16Stereo(actual.data(), mixCase.dstFrames, src.data(), mixCase.srcFrames, mixCase.ratio, gains);
+            ASSERT_EQ(expected, actual) << "frames " << mixCase.srcFrames << " -> " << mixCase.dstFrames;
+        }
+    }
+}
+
+TEST_F(AudioMixingTests, MatchesSeparatePasses)
+{
+    // The kernel rounds once instead of after every pass, so samples can be off by a few steps.
+    constexpr int32_t kTolerance = 2;
+    for (const auto& mixCase : GetCases())
+    {
+        for (int32_t amplitude : { 1000, 32768 })
+        {
+            const auto src = RandomSamples(mixCase.srcFrames * 2, amplitude);
+            const auto initial = RandomSamples(mixCase.dstFrames * 2, amplitude);
+
+            auto expected = initial;
+            auto actual = initial;
+            MixWithSeparatePasses(expected.data(), src.data(), mixCase);
+            MixResampledS16Stereo(
+                actual.data(), mixCase.dstFrames, src.data(), mixCase.srcFrames, mixCase.ratio, GetGains(mixCase));
+            for (size_t i = 0; i < expected.size(); i++)
+            {
+                ASSERT_LE(std::abs(expected[i] - actual[i]), kTolerance)
+                    << "frames " << mixCase.srcFrames << " -> " << mixCase.dstFrames << " sample " << i;
+            }
+        }
+    }
+}
+
+TEST_F(AudioMixingTests, Saturates)
+{
+    const MixCase mixCase{ 64, 64, 1.0, 1.0f, 1.0f, 1.0f, 1.0f, 128, 128 };
+    const std::vector<int16_t> src(mixCase.srcFrames * 2, 30000);
+    const auto gains = GetGains(mixCase);
+
+    std::vector<int16_t> high(mixCase.dstFrames * 2, 30000);
+    MixResampledS16Stereo(high.data(), mixCase.dstFrames, src.data(), mixCase.srcFrames, mixCase.ratio, gains);
+    EXPECT_TRUE(std::all_of(high.begin(), high.end(), [](int16_t sample) { return sample == 32767; }));
+
+    const std::vector<int16_t> negativeSrc(mixCase.srcFrames * 2, -30000);
+    std::vector<int16_t> low(mixCase.dstFrames * 2, -30000);
+    MixResampledS16Stereo(low.data(), mixCase.dstFrames, negativeSrc.data(), mixCase.srcFrames, mixCase.ratio, gains);
+    EXPECT_TRUE(std::all_of(low.begin(), low.end(), [](int16_t sample) { return sample == -32768; }));
+}
@@ -7,12 +7,16 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "KernelTests.h"
 #include "TestData.h"
 
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/drawing/ImageImporter.h>
+#include <random>
 #include <string_view>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -25,6 +29,140 @@ public:
         return Path::Combine(TestData::GetBasePath(), u8"images", name.c_str());
     }
 
+    // Random colours, some of which are taken from the palette or transparent.
+    static Image RandomImage(uint32_t width, uint32_t height)
+    {
+        std::mt19937 random(1234);
+        std::uniform_int_distribution<int> channel(0, 255);
+        Image image;
+        image.Width = width;
+        image.Height = height;
+        image.Depth = 32;
+        image.Stride = width * 4;
+        image.Pixels.resize(image.Stride * height);
+        for (size_t i = 0; i < image.Pixels.size(); i += 4)
+        {
+            const auto kind = channel(random) % 8;
+            const auto& entry = StandardPalette[channel(random)];
+            image.Pixels[i + 0] = kind == 0 ? entry.red : static_cast<uint8_t>(channel(random));
+            image.Pixels[i + 1] = kind == 0 ? entry.green : static_cast<uint8_t>(channel(random));
+            image.Pixels[i + 2] = kind == 0 ? entry.blue : static_cast<uint8_t>(channel(random));
+            image.Pixels[i + 3] = kind == 1 ? 0 : 255;
+        }
+        return image;
+    }
+
+    // The rows of a sprite sheet which hold a single sprite.
+    static Image GetRows(const Image& image, uint32_t top, uint32_t height)
+    {
+        Image result;
+        result.Width = image.Width;
+        result.Height = height;
+        result.Depth = image.Depth;
+        result.Stride = image.Stride;
+        const auto begin = image.Pixels.begin() + top * image.Stride;
+        result.Pixels.assign(begin, begin + height * image.Stride);
+        return result;
+    }
+
+    // Searches the whole palette for every pixel, the way the importer did before it split the palette into cells. When
+    // dithering, the error of each pixel is spread onto its neighbours in the same way as the importer does.
+    static std::vector<uint8_t> ReferencePalettePixels(const Image& image, ImportMode mode)
+    {
+        const auto getIndexType = [](int32_t index) {
+            if (index <= 9 || (index >= 230 && index <= 239) || index == 255)
+                return 0;
+            if (index >= 243 && index <= 254)
+                return 1;
+            if (index >= 202 && index <= 213)
+                return 2;
+            if (index >= 46 && index <= 57)
+                return 3;
+            return 4;
+        };
+        const auto findExact = [](const int16_t* colour) {
+            for (int32_t index = 0; index < 256; index++)
+            {
+                const auto& entry = StandardPalette[index];
+                if (entry.red == colour[0] && entry.green == colour[1] && entry.blue == colour[2])
+                    return index;
+            }
+            return -1;
+        };
+        const auto findClosest = [&getIndexType](const int16_t* colour) {
+            int32_t bestMatch = -1;
+            uint32_t smallestError = 0;
+            for (int32_t index = 0; index < 256; index++)
+            {
+                if (getIndexType(index) <= 1)
+                    continue;
+
+                const auto& entry = StandardPalette[index];
+                const int32_t dr = entry.red - colour[0];
+                const int32_t dg = entry.green - colour[1];
+                const int32_t db = entry.blue - colour[2];
+                const auto error = static_cast<uint32_t>(dr * dr + dg * dg + db * db);
+                if (bestMatch == -1 || smallestError > error)
+                {
+                    bestMatch = index;
+                    smallestError = error;
+                }
+            }
+            return bestMatch;
+        };
+        const auto isInPalette = [&findExact](const int16_t* colour) { return colour[3] < 128 || findExact(colour) != -1; };
+
+        const auto width = static_cast<int32_t>(image.Width);
+        const auto height = static_cast<int32_t>(image.Height);
+        std::vector<int16_t> colours(image.Pixels.begin(), image.Pixels.end());
+        std::vector<uint8_t> result;
+        for (int32_t y = 0; y < height; y++)
+        {
+            for (int32_t x = 0; x < width; x++)
+            {
+                auto* colour = &colours[(y * width + x) * 4];
+                if (colour[3] < 128)
+                {
+                    result.push_back(0);
+                    continue;
+                }
+
+                auto bestMatch = findExact(colour);
+                if (bestMatch == -1)
+                {
+                    bestMatch = findClosest(colour);
+                    const auto& entry = StandardPalette[bestMatch];
+                    const int32_t dr = colour[0] - entry.red;
+                    const int32_t dg = colour[1] - entry.green;
+                    const int32_t db = colour[2] - entry.blue;
+                    const auto diffuse = [&](int32_t dx, int32_t dy, int32_t weight) {
+                        auto* neighbour = colour + (dy * width + dx) * 4;
+                        if (isInPalette(neighbour) || getIndexType(findClosest(neighbour)) != getIndexType(bestMatch))
+                            return;
+                        neighbour[0] = static_cast<int16_t>(neighbour[0] + dr * weight / 16);
+                        neighbour[1] = static_cast<int16_t>(neighbour[1] + dg * weight / 16);
+                        neighbour[2] = static_cast<int16_t>(neighbour[2] + db * weight / 16);
+                    };
+                    if (mode == ImportMode::Dithering)
+                    {
+                        if (x + 1 < width)
+                            diffuse(1, 0, 7);
+                        if (y + 1 < height)
+                        {
+                            if (x > 0)
+                                diffuse(-1, 1, 3);
+                            diffuse(0, 1, 5);
+                            if (x + 1 < width)
+                                diffuse(1, 1, 1);
+                        }
+                    }
+                }
+                result.push_back(static_cast<uint8_t>(bestMatch));
+            }
+        }
+        return result;
+    }
+
     static uint32_t GetHash(void* buffer, size_t bufferLength)
     {
         uint32_t hash = 27;
@@ -58,3 +196,89 @@ TEST_F(ImageImporterTests, Import_Logo)
     auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
     ASSERT_EQ(uint32_t(0x212A99BC), hash);
 }
+
+TEST_F(ImageImporterTests, CreateElement_MatchesImport)
+{
+    auto logoPath = GetImagePath("logo.png");
+
+    ImageImporter importer;
+    auto image = Imaging::ReadFromFile(logoPath, ImageFormat::png32);
+    auto meta = ImageImportMeta{ .offset = { 3, 5 },
+                                 .importFlags = { ImportFlag::noDrawOnZoom },
+                                 .srcOffset = { 16, 8 },
+                                 .srcSize = { 64, 32 },
+                                 .zoomedOffset = 7 };
+    auto result = importer.Import(image, meta);
+
+    // Images of objects are registered with this element before they are decoded.
+    auto element = ImageImporter::CreateElement(meta);
+    ASSERT_EQ(nullptr, element.offset);
+    ASSERT_EQ(result.Element.width, element.width);
+    ASSERT_EQ(result.Element.height, element.height);
+    ASSERT_EQ(result.Element.xOffset, element.xOffset);
+    ASSERT_EQ(result.Element.yOffset, element.yOffset);
+    ASSERT_EQ(result.Element.flags.holder, element.flags.holder);
+    ASSERT_EQ(result.Element.zoomedOffset, element.zoomedOffset);
+}
+
+TEST_F(ImageImporterTests, Import_Closest_MatchesPaletteSearch)
+{
+    const auto image = RandomImage(256, 256);
+    auto meta = ImageImportMeta{ .importFlags = {}, .importMode = ImportMode::Closest };
+
+    ImageImporter importer;
+    auto result = importer.Import(image, meta);
+    ASSERT_EQ(ReferencePalettePixels(image, ImportMode::Closest), result.Buffer);
+}
+
+TEST_F(ImageImporterTests, Import_Dithering_MatchesPaletteSearch)
+{
+    const auto image = RandomImage(64, 64);
+    auto meta = ImageImportMeta{ .importFlags = {}, .importMode = ImportMode::Dithering };
+
+    ImageImporter importer;
+    auto result = importer.Import(image, meta);
+    const auto expected = ReferencePalettePixels(image, ImportMode::Dithering);
+    ASSERT_EQ(expected, result.Buffer);
+
+    // The error is spread onto the neighbouring pixels, so the result differs from just picking the closest colour.
+    ASSERT_NE(ReferencePalettePixels(image, ImportMode::Closest), expected);
+}
+
+// Imports a whole sheet of sprites and prints how long it takes, run with --gtest_also_run_disabled_tests.
+TEST_F(ImageImporterTests, DISABLED_Benchmark_Import)
+{
+    // A sheet of 64 full size sprites.
+    constexpr int32_t kNumSprites = 64;
+    const auto image = RandomImage(256, 256 * kNumSprites);
+    ImageImporter importer;
+
+    for (auto mode : { ImportMode::Closest, ImportMode::Dithering })
+    {
+        // Dithering does not spread the error across sprites, so the reference is made for each sprite on its own.
+        std::vector<uint8_t> expected;
+        const auto referenceMs = KernelTests::TimeMs([&] {
+            for (int32_t y = 0; y < kNumSprites; y++)
+            {
+                const auto sprite = ReferencePalettePixels(GetRows(image, y * 256, 256), mode);
+                expected.insert(expected.end(), sprite.begin(), sprite.end());
+            }
+        });
+
+        std::vector<uint8_t> actual;
+        const auto ms = KernelTests::TimeMs([&] {
+            for (int32_t y = 0; y < kNumSprites; y++)
+            {
+                auto meta = ImageImportMeta{
+                    .importFlags = {}, .importMode = mode, .srcOffset = { 0, y * 256 }, .srcSize = { 256, 256 }
+                };
+                auto result = importer.Import(image, meta);
+                actual.insert(actual.end(), result.Buffer.begin(), result.Buffer.end());
+            }
+        });
+        std::printf(
+            "%s: palette search %.3f ms, importer %.3f ms\n", mode == ImportMode::Closest ? "closest" : "dithering",
+            referenceMs, ms);
+        ASSERT_EQ(expected, actual);
+    }
+}
@@ -0,0 +1,71 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <openrct2/platform/Platform.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace KernelTests
+{
+    template<typename TFn>
+    using KernelList = std::vector<std::pair<const char*, TFn>>;
+
+    /**
+     * Returns the SIMD variants of a kernel that the CPU running the tests supports, so that each of them can be compared
+     * with the scalar variant.
+     */
+    template<typename TFn>
+    KernelList<TFn> GetSupportedKernels(TFn sse4_1, TFn avx2)
+    {
+        KernelList<TFn> result;
+        if (OpenRCT2::Platform::SSE41Available())
+            result.emplace_back("SSE4.1", sse4_1);
+        if (OpenRCT2::Platform::AVX2Available())
+            result.emplace_back("AVX2", avx2);
+        return result;
+    }
+
+    /**
+     * Returns how long the given function takes to run, for the benchmarks.
+     */
+    template<typename TFn>
+    double TimeMs(TFn&& fn)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        fn();
+        const auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    /**
+     * Base for the fixtures of kernel tests, the random input is seeded so that failures can be reproduced.
+     */
+    class Fixture : public testing::Test
+    {
+    protected:
+        std::mt19937 _random{ 1234 };
+
+        template<typename T>
+        std::vector<T> RandomValues(size_t count, int32_t minValue = 0, int32_t maxValue = 255)
+        {
+            std::uniform_int_distribution<int32_t> dist(minValue, maxValue);
+            std::vector<T> result(count);
+            for (auto& value : result)
+                value = static_cast<T>(dist(_random));
+            return result;
+        }
+    };
+} // namespace KernelTests
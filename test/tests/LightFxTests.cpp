@@ -0,0 +1,186 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "KernelTests.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/LightFX.h>
+#include <openrct2/drawing/PaletteIndex.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+using AccumulateLightFn = void (*)(uint8_t*, const uint8_t*, uint32_t, uint8_t);
+using MixLightRowFn = void (*)(uint32_t*, const PaletteIndex*, const uint8_t*, uint32_t, const uint32_t*, const uint32_t*);
+
+class LightFxTests : public KernelTests::Fixture
+{
+protected:
+    // 4K frame for the benchmark, odd widths are covered separately to exercise the scalar tails.
+    static constexpr uint32_t kWidth = 3840;
+    static constexpr uint32_t kHeight = 2160;
+
+    std::vector<uint8_t> RandomBytes(size_t count)
+    {
+        return RandomValues<uint8_t>(count);
+    }
+
+    std::vector<uint32_t> RandomPalette()
+    {
+        std::uniform_int_distribution<uint32_t> dist;
+        std::vector<uint32_t> result(256);
+        for (auto& value : result)
+            value = dist(_random);
+        return result;
+    }
+
+    static KernelTests::KernelList<AccumulateLightFn> GetAccumulateKernels()
+    {
+        return KernelTests::GetSupportedKernels<AccumulateLightFn>(
+            LightFx::AccumulateLightSse4_1, LightFx::AccumulateLightAvx2);
+    }
+
+    static KernelTests::KernelList<MixLightRowFn> GetMixKernels()
+    {
+        return KernelTests::GetSupportedKernels<MixLightRowFn>(LightFx::MixLightRowSse4_1, LightFx::MixLightRowAvx2);
+    }
+
+    // Accumulates two lights over a whole frame, as the light pass does.
+    static std::vector<uint8_t> AccumulateFrame(
+        AccumulateLightFn kernel, const std::vector<uint8_t>& lightTexture, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> lightBits(width * height);
+        for (uint8_t intensity : { 0xFF, 0x80 })
+        {
+            for (uint32_t y = 0; y < height; y++)
+                kernel(lightBits.data() + y * width, lightTexture.data() + y * width, width, intensity);
+        }
+        return lightBits;
+    }
+
+    static std::vector<uint32_t> MixFrame(
+        MixLightRowFn kernel, const std::vector<uint8_t>& bits, const std::vector<uint8_t>& lightBits,
+        const std::vector<uint32_t>& palette, const std::vector<uint32_t>& lightPalette, uint32_t width, uint32_t height)
+    {
+        const auto* indices = reinterpret_cast<const PaletteIndex*>(bits.data());
+        std::vector<uint32_t> pixels(width * height);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            kernel(
+                pixels.data() + y * width, indices + y * width, lightBits.data() + y * width, width, palette.data(),
+                lightPalette.data());
+        }
+        return pixels;
+    }
+};
+TEST_F(LightFxTests, AccumulateLight_MatchesScalar)
+{
+    const auto src = RandomBytes(1024);
+    const auto initial = RandomBytes(1024);
+    for (const auto& [name, kernel] : GetAccumulateKernels())
+    {
+        for (uint32_t count : { 0u, 1u, 15u, 16u, 31u, 33u, 255u, 1024u })
+        {
+            for (int32_t intensity = 0; intensity <= 0xFF; intensity++)
+            {
+                auto expected = initial;
+                auto actual = initial;
+                LightFx::AccumulateLightScalar(expected.data(), src.data(), count, static_cast<uint8_t>(intensity));
+                kernel(actual.data(), src.data(), count, static_cast<uint8_t>(intensity));
+                ASSERT_EQ(expected, actual) << name << " count " << count << " intensity " << intensity;
+            }
+        }
+    }
+}
+
+TEST_F(LightFxTests, MixLightRow_MatchesScalar)
+{
+    const auto palette = RandomPalette();
+    const auto lightPalette = RandomPalette();
+    const auto bits = RandomBytes(1024);
+    auto lightBits = RandomBytes(1024);
+    // Make sure unlit pixels are covered as well.
+    for (size_t i = 0; i < lightBits.size(); i += 3)
+        lightBits[i] = 0;
+
+    const auto* indices = reinterpret_cast<const PaletteIndex*>(bits.data());
+    for (const auto& [name, kernel] : GetMixKernels())
+    {
+        for (uint32_t count : { 0u, 1u, 3u, 4u, 7u, 9u, 255u, 1024u })
+        {
+            std::vector<uint32_t> expected(count);
+            std::vector<uint32_t> actual(count);
+            LightFx::MixLightRowScalar(
+                expected.data(), indices, lightBits.data(), count, palette.data(), lightPalette.data());
+            kernel(actual.data(), indices, lightBits.data(), count, palette.data(), lightPalette.data());
+            ASSERT_EQ(expected, actual) << name << " count " << count;
+        }
+    }
+}
+
+TEST_F(LightFxTests, Frame_MatchesScalar)
+{
+    // A small frame with an odd width, so that the rows do not start on a vector boundary.
+    constexpr uint32_t kFrameWidth = 641;
+    constexpr uint32_t kFrameHeight = 360;
+    const auto palette = RandomPalette();
+    const auto lightPalette = RandomPalette();
+    const auto bits = RandomBytes(kFrameWidth * kFrameHeight);
+    const auto lightTexture = RandomBytes(kFrameWidth * kFrameHeight);
+
+    const auto expectedLight = AccumulateFrame(LightFx::AccumulateLightScalar, lightTexture, kFrameWidth, kFrameHeight);
+    const auto expectedPixels = MixFrame(
+        LightFx::MixLightRowScalar, bits, expectedLight, palette, lightPalette, kFrameWidth, kFrameHeight);
+    for (const auto& [name, kernel] : GetAccumulateKernels())
+    {
+        ASSERT_EQ(expectedLight, AccumulateFrame(kernel, lightTexture, kFrameWidth, kFrameHeight)) << name;
+    }
+    for (const auto& [name, kernel] : GetMixKernels())
+    {
+        const auto actual = MixFrame(kernel, bits, expectedLight, palette, lightPalette, kFrameWidth, kFrameHeight);
+        ASSERT_EQ(expectedPixels, actual) << name;
+    }
+}
+
+// Lights a whole 4K frame and prints how long it takes, run with --gtest_also_run_disabled_tests.
+TEST_F(LightFxTests, DISABLED_Benchmark_4K)
+{
+    const auto palette = RandomPalette();
+    const auto lightPalette = RandomPalette();
+    const auto bits = RandomBytes(kWidth * kHeight);
+    const auto lightTexture = RandomBytes(kWidth * kHeight);
+
+    std::vector<uint8_t> expectedLight;
+    std::vector<uint32_t> expectedPixels;
+    const auto scalarAccumulateMs = KernelTests::TimeMs(
+        [&] { expectedLight = AccumulateFrame(LightFx::AccumulateLightScalar, lightTexture, kWidth, kHeight); });
+    const auto scalarMixMs = KernelTests::TimeMs([&] {
+        expectedPixels = MixFrame(LightFx::MixLightRowScalar, bits, expectedLight, palette, lightPalette, kWidth, kHeight);
+    });
+    std::printf("scalar: accumulate %.3f ms, mix %.3f ms\n", scalarAccumulateMs, scalarMixMs);
+
+    for (const auto& [name, kernel] : GetAccumulateKernels())
+    {
+        std::vector<uint8_t> actual;
+        const auto ms = KernelTests::TimeMs([&] { actual = AccumulateFrame(kernel, lightTexture, kWidth, kHeight); });
+        std::printf("%s: accumulate %.3f ms\n", name, ms);
+        ASSERT_EQ(expectedLight, actual) << name;
+    }
+    for (const auto& [name, kernel] : GetMixKernels())
+    {
+        std::vector<uint32_t> actual;
+        const auto ms = KernelTests::TimeMs(
+            [&] { actual = MixFrame(kernel, bits, expectedLight, palette, lightPalette, kWidth, kHeight); });
+        std::printf("%s: mix %.3f ms\n", name, ms);
+        ASSERT_EQ(expectedPixels, actual) << name;
+    }
+}
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/map_generator/MapGen.h>
+#include <openrct2/world/tile_element/TileElement.h>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::World;
+
+class MapGeneratorTests : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+
+        // The park is only used for its terrain and tree objects.
+        ASSERT_TRUE(_context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    // Generates a map and returns the bytes of all its tile elements, tile by tile.
+    static std::vector<uint8_t> GenerateMap(const TileCoordsXY& mapSize, bool multiThreading)
+    {
+        auto& config = Config::Get().general;
+        const auto oldMultiThreading = config.multiThreading.load();
+        config.multiThreading = multiThreading;
+
+        MapGenerator::Settings settings{};
+        settings.algorithm = MapGenerator::Algorithm::simplexNoise;
+        settings.mapSize = mapSize;
+        settings.seed = 1234;
+        MapGenerator::generate(&settings);
+
+        config.multiThreading = oldMultiThreading;
+
+        std::vector<uint8_t> result;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                const auto* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (element == nullptr)
+                    continue;
+
+                do
+                {
+                    const auto offset = result.size();
+                    result.resize(offset + sizeof(TileElement));
+                    std::memcpy(result.data() + offset, element, sizeof(TileElement));
+                } while (!(element++)->isLastForTile());
+            }
+        }
+        return result;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> MapGeneratorTests::_context;
+
+TEST_F(MapGeneratorTests, SameMapWithAndWithoutJobPool)
+{
+    // Sizes that do not split evenly into bands of rows, including one that is not square.
+    for (const auto mapSize : { TileCoordsXY{ 67, 67 }, TileCoordsXY{ 200, 131 } })
+    {
+        const auto singleThreaded = GenerateMap(mapSize, false);
+        const auto multiThreaded = GenerateMap(mapSize, true);
+        ASSERT_FALSE(singleThreaded.empty());
+        EXPECT_EQ(singleThreaded, multiThreaded) << "map size " << mapSize.x << "x" << mapSize.y;
+
+        // The same seed gives the same map again.
+        EXPECT_EQ(singleThreaded, GenerateMap(mapSize, false)) << "map size " << mapSize.x << "x" << mapSize.y;
+    }
+}
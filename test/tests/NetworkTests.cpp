@@ -12,7 +12,9 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/network/NetworkBase.h>
 #include <openrct2/network/NetworkConnection.h>
+#include <openrct2/network/NetworkIOThread.h>
 #include <openrct2/network/NetworkPacket.h>
+#include <thread>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Network;
@@ -65,10 +67,23 @@ public:
         _inboundOffset = 0;
     }
 
-    size_t SendData(const void*, size_t size) override
+    size_t SendData(const void* buffer, size_t size) override
     {
+        size = std::min(size, _sendLimit - _sentData.size());
+        _sentData.insert(_sentData.end(), static_cast<const uint8_t*>(buffer), static_cast<const uint8_t*>(buffer) + size);
         return size;
     }
+
+    // Makes the socket accept no more than the given amount of data in total, as if its send buffer were full.
+    void SetSendLimit(size_t limit)
+    {
+        _sendLimit = limit;
+    }
+
+    const std::vector<uint8_t>& GetSentData() const
+    {
+        return _sentData;
+    }
     ReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_inboundOffset >= _inboundData.size())
@@ -104,6 +119,8 @@ private:
     SocketStatus _status = SocketStatus::connected;
     std::vector<uint8_t> _inboundData;
     size_t _inboundOffset = 0;
+    std::vector<uint8_t> _sentData;
+    size_t _sendLimit = std::numeric_limits<size_t>::max();
 };
 
 class NetworkTests : public testing::Test
@@ -145,3 +162,108 @@ TEST_F(NetworkTests, MapRequestWithoutPlayerDisconnectsAndDoesNotCrash)
 
     EXPECT_TRUE(connection.shouldDisconnect);
 }
+
+static void AppendPacket(std::vector<uint8_t>& data, Command command, const std::vector<uint8_t>& body)
+{
+    PacketHeader header{};
+    header.magic = Convert::HostToNetwork(PacketHeader::kMagic);
+    header.version = Convert::HostToNetwork(PacketHeader::kVersion);
+    header.size = Convert::HostToNetwork(static_cast<uint32_t>(body.size()));
+    header.id = Convert::HostToNetwork(command);
+
+    const auto* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    data.insert(data.end(), headerBytes, headerBytes + sizeof(header));
+    data.insert(data.end(), body.begin(), body.end());
+}
+
+TEST_F(NetworkTests, IOThreadQueuesFramedPackets)
+{
+    std::vector<uint8_t> inboundData;
+    AppendPacket(inboundData, Command::chat, { 1, 2, 3 });
+    AppendPacket(inboundData, Command::ping, {});
+
+    Connection connection;
+    auto mockSocket = std::make_unique<MockTcpSocket>();
+    mockSocket->SetInboundData(inboundData);
+    connection.socket = std::move(mockSocket);
+
+    MockTcpSocket listenSocket;
+    listenSocket.Listen(0);
+
+    std::vector<Packet> packets;
+    {
+        IOThread ioThread(listenSocket);
+        ioThread.addConnection(connection);
+
+        const auto start = std::chrono::steady_clock::now();
+        while (packets.size() < 2 && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+        {
+            if (connection.readPacket() == ReadPacket::success)
+            {
+                packets.push_back(connection.inboundPacket);
+                connection.inboundPacket.clear();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        ioThread.removeConnection(connection);
+    }
+
+    ASSERT_EQ(packets.size(), 2u);
+    EXPECT_EQ(packets[0].getCommand(), Command::chat);
+    EXPECT_EQ(std::vector<uint8_t>(packets[0].data.begin(), packets[0].data.end()), (std::vector<uint8_t>{ 1, 2, 3 }));
+    EXPECT_EQ(packets[1].getCommand(), Command::ping);
+    EXPECT_TRUE(packets[1].data.empty());
+    EXPECT_EQ(connection.stats.bytesReceived[EnumValue(StatisticsGroup::total)], inboundData.size());
+}
+
+TEST_F(NetworkTests, BroadcastPacketIsSerialisedOnce)
+{
+    Packet packet(Command::tick);
+    packet << static_cast<uint32_t>(1234);
+
+    BroadcastPacket broadcast(packet);
+    const auto& serialised = broadcast.getSerialised(false);
+    EXPECT_EQ(broadcast.getSerialised(false), serialised);
+    EXPECT_NE(broadcast.getSerialised(true), serialised);
+
+    std::vector<uint8_t> expected;
+    AppendPacket(expected, Command::tick, { 0, 0, 0x04, 0xD2 });
+    EXPECT_EQ(*serialised, expected);
+}
+
+TEST_F(NetworkTests, QueuedPacketsKeepOrderAcrossPartialSends)
+{
+    Connection connection;
+    auto mockSocket = std::make_unique<MockTcpSocket>();
+    auto* socket = mockSocket.get();
+    connection.socket = std::move(mockSocket);
+    connection.authStatus = Auth::ok;
+
+    std::vector<uint8_t> chat;
+    AppendPacket(chat, Command::chat, { 1, 2, 3 });
+    std::vector<uint8_t> tick;
+    AppendPacket(tick, Command::tick, {});
+    std::vector<uint8_t> ping;
+    AppendPacket(ping, Command::ping, {});
+
+    // Leave the first packet half sent, a packet queued at the front must not end up in the middle of it.
+    const uint8_t chatBody[] = { 1, 2, 3 };
+    Packet chatPacket(Command::chat);
+    chatPacket.write(chatBody, sizeof(chatBody));
+    connection.queuePacket(chatPacket);
+    connection.queuePacket(Packet(Command::tick));
+    socket->SetSendLimit(chat.size() / 2);
+    connection.sendQueuedData();
+
+    connection.queuePacket(Packet(Command::ping), true);
+    socket->SetSendLimit(std::numeric_limits<size_t>::max());
+    connection.sendQueuedData();
+
+    std::vector<uint8_t> expected = chat;
+    expected.insert(expected.end(), ping.begin(), ping.end());
+    expected.insert(expected.end(), tick.begin(), tick.end());
+    EXPECT_EQ(socket->GetSentData(), expected);
+}
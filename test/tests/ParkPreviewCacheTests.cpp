@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/core/FileStream.h>
+#include <openrct2/park/ParkPreview.h>
+#include <openrct2/park/ParkPreviewCache.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace fs = std::filesystem;
+
+static void ExpectSamePreview(const ParkPreview& expected, const ParkPreview& actual)
+{
+    EXPECT_EQ(expected.parkName, actual.parkName);
+    EXPECT_EQ(expected.parkRating, actual.parkRating);
+    EXPECT_EQ(expected.year, actual.year);
+    EXPECT_EQ(expected.month, actual.month);
+    EXPECT_EQ(expected.day, actual.day);
+    EXPECT_EQ(expected.parkUsesMoney, actual.parkUsesMoney);
+    EXPECT_EQ(expected.cash, actual.cash);
+    EXPECT_EQ(expected.numRides, actual.numRides);
+    EXPECT_EQ(expected.numGuests, actual.numGuests);
+    ASSERT_EQ(expected.images.size(), actual.images.size());
+    for (size_t i = 0; i < expected.images.size(); i++)
+    {
+        const auto& expectedImage = expected.images[i];
+        const auto& actualImage = actual.images[i];
+        EXPECT_EQ(expectedImage.type, actualImage.type);
+        ASSERT_EQ(expectedImage.width, actualImage.width);
+        ASSERT_EQ(expectedImage.height, actualImage.height);
+        const auto numPixels = expectedImage.width * expectedImage.height;
+        EXPECT_TRUE(std::equal(expectedImage.pixels, expectedImage.pixels + numPixels, actualImage.pixels));
+    }
+}
+
+TEST(ParkPreviewCache, MatchesFullLoad)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    ASSERT_NE(context, nullptr);
+    ASSERT_TRUE(context->Initialise());
+
+    const auto parkPath = TestData::GetParkPath("testReversedTrains.park");
+    auto fileStream = FileStream(parkPath, FileMode::open);
+    auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
+    importer->LoadFromStream(&fileStream, false, true);
+    const auto expected = importer->GetParkPreview();
+
+    const auto directory = fs::temp_directory_path() / "openrct2_park_preview_cache_test";
+    fs::remove_all(directory);
+    {
+        ParkPreviewCache cache(directory.string());
+        EXPECT_EQ(cache.TryGetRecent(parkPath), nullptr);
+
+        auto preview = cache.Get(parkPath);
+        ASSERT_NE(preview, nullptr);
+        ExpectSamePreview(expected, *preview);
+        EXPECT_EQ(cache.TryGetRecent(parkPath), preview);
+    }
+    EXPECT_EQ(std::distance(fs::directory_iterator(directory), fs::directory_iterator()), 1);
+
+    // A new cache reads the preview from the cache directory instead of the park.
+    {
+        ParkPreviewCache cache(directory.string());
+        auto preview = cache.Get(parkPath);
+        ASSERT_NE(preview, nullptr);
+        ExpectSamePreview(expected, *preview);
+    }
+
+    // Files that are not parks have no preview.
+    ParkPreviewCache cache(directory.string());
+    EXPECT_EQ(cache.Get(TestData::GetParkPath("volcania.sea")), nullptr);
+
+    fs::remove_all(directory);
+}
+
+TEST(ParkPreviewCache, RemovesOldestPreviews)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    ASSERT_NE(context, nullptr);
+    ASSERT_TRUE(context->Initialise());
+
+    const auto directory = fs::temp_directory_path() / "openrct2_park_preview_cache_prune_test";
+    const auto parksDirectory = directory / "parks";
+    const auto cacheDirectory = directory / "cache";
+    fs::remove_all(directory);
+    fs::create_directories(parksDirectory);
+
+    std::vector<std::string> parkPaths;
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const auto parkPath = parksDirectory / ("park" + std::to_string(i) + ".park");
+        fs::copy_file(TestData::GetParkPath("testReversedTrains.park"), parkPath);
+        parkPaths.push_back(parkPath.string());
+    }
+
+    const auto countCachedPreviews = [&cacheDirectory]() {
+        return std::distance(fs::directory_iterator(cacheDirectory), fs::directory_iterator());
+    };
+
+    {
+        ParkPreviewCache cache(cacheDirectory.string(), 2);
+        for (int32_t i = 0; i < 3; i++)
+        {
+            ASSERT_NE(cache.Get(parkPaths[i]), nullptr);
+        }
+        EXPECT_EQ(countCachedPreviews(), 2);
+    }
+
+    // The limit also applies to previews written in earlier sessions.
+    {
+        ParkPreviewCache cache(cacheDirectory.string(), 1);
+        ASSERT_NE(cache.Get(parkPaths[3]), nullptr);
+        EXPECT_EQ(countCachedPreviews(), 1);
+    }
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/core/Json.hpp>
+#include <openrct2/profiling/Profiling.h>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static void ProfiledChild()
+{
+    PROFILED_FUNCTION();
+}
+
+static void ProfiledParent()
+{
+    PROFILED_FUNCTION();
+    ProfiledChild();
+    ProfiledChild();
+}
+
+static Profiling::Function* FindFunction(const char* name)
+{
+    const auto& data = Profiling::getData();
+    auto it = std::find_if(data.begin(), data.end(), [name](const Profiling::Function* func) {
+        return std::strstr(func->getName(), name) != nullptr;
+    });
+    return it != data.end() ? *it : nullptr;
+}
+
+class ProfilingTests : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Profiling::resetData();
+        Profiling::enable();
+    }
+
+    void TearDown() override
+    {
+        Profiling::disable();
+        Profiling::resetData();
+    }
+};
+
+TEST_F(ProfilingTests, MergesThreads)
+{
+    constexpr int32_t kNumThreads = 4;
+    constexpr int32_t kCallsPerThread = 1000;
+
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < kNumThreads; i++)
+    {
+        threads.emplace_back([] {
+            for (int32_t j = 0; j < kCallsPerThread; j++)
+                ProfiledParent();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    auto* parent = FindFunction("ProfiledParent");
+    auto* child = FindFunction("ProfiledChild");
+    ASSERT_NE(parent, nullptr);
+    ASSERT_NE(child, nullptr);
+    EXPECT_EQ(parent->getCallCount(), static_cast<uint64_t>(kNumThreads * kCallsPerThread));
+    EXPECT_EQ(child->getCallCount(), static_cast<uint64_t>(2 * kNumThreads * kCallsPerThread));
+    EXPECT_LE(child->getMinTime(), child->getMaxTime());
+    EXPECT_EQ(parent->getTimeSamples().size(), Profiling::Detail::MaxSamplesSize);
+    EXPECT_EQ(child->getParents(), std::vector<Profiling::Function*>{ parent });
+    EXPECT_EQ(parent->getChildren(), std::vector<Profiling::Function*>{ child });
+
+    Profiling::resetData();
+    EXPECT_EQ(parent->getCallCount(), 0u);
+    EXPECT_TRUE(parent->getChildren().empty());
+}
+
+TEST_F(ProfilingTests, TraceHasThreadsAndMarkers)
+{
+    Profiling::addMarker(Profiling::Marker::frame);
+    ProfiledParent();
+    std::thread([] {
+        Profiling::setThreadName("Test thread");
+        ProfiledParent();
+    }).join();
+
+    const auto trace = Json::FromString(Profiling::getTrace());
+    const auto& events = trace["traceEvents"];
+    ASSERT_TRUE(events.is_array());
+
+    size_t numCalls = 0;
+    size_t numFrames = 0;
+    bool hasThreadName = false;
+    for (const auto& event : events)
+    {
+        const auto phase = event["ph"].get<std::string>();
+        if (phase == "X")
+            numCalls++;
+        else if (phase == "i" && event["name"] == "Frame")
+            numFrames++;
+        else if (phase == "M" && event["name"] == "thread_name" && event["args"]["name"] == "Test thread")
+            hasThreadName = true;
+    }
+    EXPECT_EQ(numCalls, 6u);
+    EXPECT_EQ(numFrames, 1u);
+    EXPECT_TRUE(hasThreadName);
+}
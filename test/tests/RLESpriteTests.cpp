@@ -0,0 +1,280 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "KernelTests.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Colour.h>
+#include <openrct2/drawing/Drawing.Sprite.h>
+#include <openrct2/drawing/PaletteIndex.h>
+#include <openrct2/drawing/PaletteMap.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+using CopyRLERunFn = void (*)(PaletteIndex*, const PaletteIndex*, int32_t, int32_t);
+using RemapRLERunFn = void (*)(PaletteIndex*, const PaletteIndex*, int32_t, int32_t, const PaletteIndex*);
+
+class RLESpriteTests : public KernelTests::Fixture
+{
+protected:
+    static constexpr int32_t kSpriteWidth = 250;
+    static constexpr int32_t kSpriteHeight = 64;
+
+    void TearDown() override
+    {
+        // Zoomed out draws go through the decimated sprite cache, which must not keep pointers to the test sprites.
+        GfxClearDecimatedSprites();
+    }
+
+    std::vector<PaletteIndex> RandomPixels(size_t count, int32_t minValue = 0)
+    {
+        auto result = RandomValues<PaletteIndex>(count, minValue);
+        // Make sure transparent pixels are covered as well.
+        if (minValue == 0)
+        {
+            for (size_t i = 0; i < result.size(); i += 7)
+                result[i] = PaletteIndex::transparent;
+        }
+        return result;
+    }
+
+    // Encodes runs of random length and random gaps for every line, in the same format as the g1 sprites.
+    std::vector<uint8_t> RandomRLESprite()
+    {
+        std::uniform_int_distribution<int32_t> runLength(1, 127);
+        std::uniform_int_distribution<int32_t> gapLength(0, 12);
+        std::uniform_int_distribution<int> pixel(1, 255);
+
+        std::vector<uint8_t> lines;
+        std::vector<uint16_t> offsets;
+        for (int32_t y = 0; y < kSpriteHeight; y++)
+        {
+            offsets.push_back(static_cast<uint16_t>(kSpriteHeight * sizeof(uint16_t) + lines.size()));
+            int32_t x = gapLength(_random);
+            while (true)
+            {
+                const int32_t length = std::min(runLength(_random), kSpriteWidth - x);
+                const int32_t nextX = x + length + gapLength(_random);
+                const bool lastRun = nextX >= kSpriteWidth - 1;
+                lines.push_back(static_cast<uint8_t>(length | (lastRun ? 0x80 : 0)));
+                lines.push_back(static_cast<uint8_t>(x));
+                for (int32_t i = 0; i < length; i++)
+                    lines.push_back(static_cast<uint8_t>(pixel(_random)));
+                if (lastRun)
+                    break;
+                x = nextX;
+            }
+        }
+
+        std::vector<uint8_t> result;
+        for (auto offset : offsets)
+        {
+            result.push_back(static_cast<uint8_t>(offset & 0xFF));
+            result.push_back(static_cast<uint8_t>(offset >> 8));
+        }
+        result.insert(result.end(), lines.begin(), lines.end());
+        return result;
+    }
+
+    static KernelTests::KernelList<CopyRLERunFn> GetCopyKernels()
+    {
+        return KernelTests::GetSupportedKernels<CopyRLERunFn>(CopyRLERunSse4_1, CopyRLERunAvx2);
+    }
+
+    static KernelTests::KernelList<RemapRLERunFn> GetRemapKernels()
+    {
+        return KernelTests::GetSupportedKernels<RemapRLERunFn>(RemapRLERunSse4_1, RemapRLERunAvx2);
+    }
+
+    static KernelTests::KernelList<RemapRLERunFn> GetGlassKernels()
+    {
+        return KernelTests::GetSupportedKernels<RemapRLERunFn>(GlassRLERunSse4_1, GlassRLERunAvx2);
+    }
+};
+
+TEST_F(RLESpriteTests, CopyRun_MatchesScalar)
+{
+    const auto src = RandomPixels(1024);
+    const auto initial = RandomPixels(1024);
+    for (const auto& [name, kernel] : GetCopyKernels())
+    {
+        for (int32_t zoomShift = 0; zoomShift <= 3; zoomShift++)
+        {
+            for (int32_t numPixels = 0; numPixels <= 1024; numPixels++)
+            {
+                auto expected = initial;
+                auto actual = initial;
+                CopyRLERunScalar(expected.data(), src.data(), numPixels, zoomShift);
+                kernel(actual.data(), src.data(), numPixels, zoomShift);
+                ASSERT_EQ(expected, actual) << name << " zoom " << zoomShift << " pixels " << numPixels;
+            }
+        }
+    }
+}
+
+TEST_F(RLESpriteTests, RemapRun_MatchesScalar)
+{
+    auto paletteMap = RandomPixels(256);
+    const auto src = RandomPixels(1024);
+    const auto initial = RandomPixels(1024);
+    for (const auto& [name, kernel] : GetRemapKernels())
+    {
+        for (int32_t zoomShift = 0; zoomShift <= 3; zoomShift++)
+        {
+            for (int32_t numPixels = 0; numPixels <= 1024; numPixels++)
+            {
+                auto expected = initial;
+                auto actual = initial;
+                RemapRLERunScalar(expected.data(), src.data(), numPixels, zoomShift, paletteMap.data());
+                kernel(actual.data(), src.data(), numPixels, zoomShift, paletteMap.data());
+                ASSERT_EQ(expected, actual) << name << " zoom " << zoomShift << " pixels " << numPixels;
+            }
+        }
+    }
+}
+
+TEST_F(RLESpriteTests, GlassRun_MatchesScalar)
+{
+    auto paletteMap = RandomPixels(256);
+    const auto src = RandomPixels(1024);
+    const auto initial = RandomPixels(1024);
+    for (const auto& [name, kernel] : GetGlassKernels())
+    {
+        for (int32_t zoomShift = 0; zoomShift <= 3; zoomShift++)
+        {
+            for (int32_t numPixels = 0; numPixels <= 1024; numPixels++)
+            {
+                auto expected = initial;
+                auto actual = initial;
+                GlassRLERunScalar(expected.data(), src.data(), numPixels, zoomShift, paletteMap.data());
+                kernel(actual.data(), src.data(), numPixels, zoomShift, paletteMap.data());
+                ASSERT_EQ(expected, actual) << name << " zoom " << zoomShift << " pixels " << numPixels;
+            }
+        }
+    }
+}
+
+TEST_F(RLESpriteTests, DrawSprite_MatchesPerPixelBlit)
+{
+    auto spriteData = RandomRLESprite();
+    G1Element g1{};
+    g1.offset = spriteData.data();
+    g1.width = kSpriteWidth;
+    g1.height = kSpriteHeight;
+
+    // Decode the sprite once, the reference image is then drawn one pixel at a time with BlitPixel.
+    std::vector<PaletteIndex> decoded(kSpriteWidth * kSpriteHeight);
+    std::vector<bool> opaque(kSpriteWidth * kSpriteHeight);
+    for (int32_t y = 0; y < kSpriteHeight; y++)
+    {
+        const uint8_t* run = spriteData.data() + (spriteData[y * 2] | (spriteData[y * 2 + 1] << 8));
+        bool lastRun = false;
+        while (!lastRun)
+        {
+            const int32_t length = run[0] & 0x7F;
+            const int32_t x = run[1];
+            lastRun = (run[0] & 0x80) != 0;
+            for (int32_t i = 0; i < length; i++)
+            {
+                decoded[y * kSpriteWidth + x + i] = static_cast<PaletteIndex>(run[2 + i]);
+                opaque[y * kSpriteWidth + x + i] = true;
+            }
+            run += 2 + length;
+        }
+    }
+
+    auto remapTable = RandomPixels(256);
+    auto blendTable = RandomPixels(255 * 256);
+    const auto initial = RandomPixels(kSpriteWidth * kSpriteHeight);
+
+    struct BlendCase
+    {
+        const char* name;
+        ImageId image;
+        PaletteMap paletteMap;
+    };
+    const BlendCase cases[] = {
+        { "copy", ImageId(0), PaletteMap(remapTable) },
+        { "remap", ImageId(0, Colour::black), PaletteMap(remapTable) },
+        { "glass", ImageId(0).WithBlended(true), PaletteMap(remapTable) },
+        { "blend", ImageId(0, Colour::black).WithBlended(true), PaletteMap(blendTable.data(), 255, 256) },
+    };
+
+    struct ClipCase
+    {
+        int32_t srcX;
+        int32_t srcY;
+        int32_t width;
+        int32_t height;
+    };
+    // Sprites are always clipped at multiples of the zoom horizontally, but not vertically.
+    const ClipCase clips[] = {
+        { 0, 0, kSpriteWidth, kSpriteHeight },
+        { 8, 3, 101, 37 },
+        { 16, 1, kSpriteWidth - 16, kSpriteHeight - 1 },
+        { 0, 5, 57, 20 },
+    };
+
+    for (const auto& blendCase : cases)
+    {
+        for (const auto& clip : clips)
+        {
+            // Zoomed in sprites are clipped in destination pixels, each sprite pixel covers several of them.
+            for (int8_t zoom = -2; zoom <= 3; zoom++)
+            {
+                RenderTarget rt;
+                rt.width = kSpriteWidth;
+                rt.height = kSpriteHeight;
+                rt.zoom_level = ZoomLevel{ zoom };
+
+                auto expected = initial;
+                const auto blit = [&](int32_t x, int32_t y, PaletteIndex* dst) {
+                    if (!opaque[y * kSpriteWidth + x])
+                        return;
+                    const auto* src = &decoded[y * kSpriteWidth + x];
+                    if (blendCase.image.HasPrimary() && blendCase.image.IsBlended())
+                        BlitPixel<kBlendTransparent | kBlendSrc | kBlendDst>(src, dst, blendCase.paletteMap);
+                    else if (blendCase.image.HasPrimary())
+                        BlitPixel<kBlendTransparent | kBlendSrc>(src, dst, blendCase.paletteMap);
+                    else if (blendCase.image.IsBlended())
+                        BlitPixel<kBlendTransparent | kBlendDst>(src, dst, blendCase.paletteMap);
+                    else
+                        BlitPixel<kBlendTransparent>(src, dst, blendCase.paletteMap);
+                };
+                if (zoom < 0)
+                {
+                    for (int32_t i = 0; i < clip.height; i++)
+                    {
+                        for (int32_t j = 0; j < clip.width; j++)
+                            blit((clip.srcX + j) >> -zoom, (clip.srcY + i) >> -zoom, &expected[i * kSpriteWidth + j]);
+                    }
+                }
+                else
+                {
+                    for (int32_t i = 0; i < clip.height; i += (1 << zoom))
+                    {
+                        for (int32_t j = 0; j < clip.width; j += (1 << zoom))
+                            blit(clip.srcX + j, clip.srcY + i, &expected[(i >> zoom) * kSpriteWidth + (j >> zoom)]);
+                    }
+                }
+
+                auto actual = initial;
+                rt.bits = actual.data();
+                DrawSpriteArgs args(
+                    blendCase.image, blendCase.paletteMap, g1, clip.srcX, clip.srcY, clip.width, clip.height, actual.data());
+                GfxRleSpriteToBuffer(rt, args);
+                ASSERT_EQ(expected, actual) << blendCase.name << " zoom " << static_cast<int32_t>(zoom) << " clip "
+                                            << clip.srcX << "," << clip.srcY;
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "KernelTests.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/PaletteIndex.h>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+using RemapRectKernel = void (*)(PaletteIndex*, int32_t, int32_t, int32_t, const PaletteIndex*);
+
+class RemapRectTests : public KernelTests::Fixture
+{
+};
+
+TEST_F(RemapRectTests, MatchesScalar)
+{
+    constexpr int32_t kHeight = 5;
+    const auto paletteMap = RandomValues<PaletteIndex>(256);
+    for (const auto& [name, kernel] : KernelTests::GetSupportedKernels<RemapRectKernel>(RemapRectSse4_1, RemapRectAvx2))
+    {
+        for (int32_t width = 0; width <= 160; width++)
+        {
+            for (int32_t dstWrap : { 0, 3, 64 })
+            {
+                const auto initial = RandomValues<PaletteIndex>((width + dstWrap) * kHeight);
+                auto expected = initial;
+                auto actual = initial;
+                RemapRectScalar(expected.data(), width, kHeight, dstWrap, paletteMap.data());
+                kernel(actual.data(), width, kHeight, dstWrap, paletteMap.data());
+                ASSERT_EQ(expected, actual) << name << " width " << width << " wrap " << dstWrap;
+            }
+        }
+    }
+}
+
+TEST_F(RemapRectTests, MatchesGoldenImage)
+{
+    // A gradient render target with a rectangle remapped through a map that swaps the two halves of the palette.
+    // Every pixel inside the rectangle must be remapped exactly once and every pixel outside it left untouched.
+    constexpr int32_t kWidth = 301;
+    constexpr int32_t kHeight = 67;
+    constexpr int32_t kLeft = 13;
+    constexpr int32_t kTop = 7;
+    constexpr int32_t kRectWidth = 251;
+    constexpr int32_t kRectHeight = 50;
+
+    std::vector<PaletteIndex> paletteMap(256);
+    for (int32_t i = 0; i < 256; i++)
+        paletteMap[i] = static_cast<PaletteIndex>(i ^ 0x80);
+
+    std::vector<PaletteIndex> image(kWidth * kHeight);
+    std::vector<PaletteIndex> golden(kWidth * kHeight);
+    for (int32_t y = 0; y < kHeight; y++)
+    {
+        for (int32_t x = 0; x < kWidth; x++)
+        {
+            const auto pixel = static_cast<uint8_t>(x * 3 + y * 5);
+            const bool inside = x >= kLeft && x < kLeft + kRectWidth && y >= kTop && y < kTop + kRectHeight;
+            image[y * kWidth + x] = static_cast<PaletteIndex>(pixel);
+            golden[y * kWidth + x] = static_cast<PaletteIndex>(inside ? pixel ^ 0x80 : pixel);
+        }
+    }
+
+    RemapRectFn(image.data() + kTop * kWidth + kLeft, kRectWidth, kRectHeight, kWidth - kRectWidth, paletteMap.data());
+    ASSERT_EQ(golden, image);
+}
@@ -10,20 +10,29 @@
 #include "TestData.h"
 
 #include <exception>
+#include <iterator>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <openrct2/Context.h>
 #include <openrct2/Diagnostic.h>
+#include <openrct2/Game.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ReplayManager.h>
+#include <openrct2/command_line/CommandLine.hpp>
 #include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
 #include <openrct2/platform/Platform.h>
 #include <string>
 
 using namespace OpenRCT2;
 
+namespace fs = std::filesystem;
+
 struct ReplayTestData
 {
     std::string name;
@@ -102,6 +111,197 @@ TEST_P(ReplayTests, RunReplay)
     ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
 }
 
+TEST(ReplaySeekTests, SeekBackToStartReplaysAgain)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto replays = GetReplayFiles();
+    ASSERT_FALSE(replays.empty());
+
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    replayManager->StartPlayback(replays[0].filePath);
+    const auto startTick = getGameState().currentTicks;
+
+    // Run part of the replay, then go back to the start and play all of it.
+    for (int32_t i = 0; i < 100 && replayManager->IsReplaying(); i++)
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_TRUE(replayManager->IsReplaying());
+    EXPECT_EQ(replayManager->SeekPlayback(startTick), startTick);
+    EXPECT_EQ(getGameState().currentTicks, startTick);
+
+    while (replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching())
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->GetPlaybackMismatchTick().has_value());
+}
+
+static std::string GetTemporaryReplayPath(const char* name)
+{
+    auto path = (fs::temp_directory_path() / name).string();
+    fs::remove(path);
+    return path;
+}
+
+static void RecordReplay(IContext& context, const std::string& path, int32_t ticks)
+{
+    context.LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+    GameLoadInit();
+
+    IReplayManager* replayManager = context.GetReplayManager();
+    ASSERT_TRUE(replayManager->StartRecording(path));
+    for (int32_t i = 0; i < ticks; i++)
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_TRUE(replayManager->StopRecording());
+}
+
+TEST(ReplayRecordTests, PlaybackRightAfterRecording)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+
+    const auto replayPath = GetTemporaryReplayPath("openrct2_replay_record_test.parkrep");
+    RecordReplay(*context, replayPath, 200);
+
+    // The recording is written on another thread, playback has to wait for it to be complete.
+    IReplayManager* replayManager = context->GetReplayManager();
+    replayManager->StartPlayback(replayPath);
+    ASSERT_TRUE(replayManager->IsReplaying());
+    while (replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching())
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->GetPlaybackMismatchTick().has_value());
+
+    fs::remove(replayPath);
+}
+
+TEST(ReplaySeekTests, SeekToKeyframes)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    replayManager->SetKeyframeInterval(50);
+
+    const auto replayPath = GetTemporaryReplayPath("openrct2_replay_keyframe_test.parkrep");
+    RecordReplay(*context, replayPath, 230);
+
+    replayManager->StartPlayback(replayPath);
+    const auto startTick = getGameState().currentTicks;
+    for (int32_t i = 0; i < 20; i++)
+    {
+        gameStateUpdateLogic();
+    }
+
+    // Forwards, past two keyframes.
+    EXPECT_EQ(replayManager->SeekPlayback(startTick + 170), startTick + 150);
+    EXPECT_EQ(getGameState().currentTicks, startTick + 150);
+    for (int32_t i = 0; i < 30; i++)
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_TRUE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+
+    // Backwards, to a tick after a keyframe.
+    EXPECT_EQ(replayManager->SeekPlayback(startTick + 120), startTick + 100);
+    EXPECT_EQ(getGameState().currentTicks, startTick + 100);
+
+    while (replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching())
+    {
+        gameStateUpdateLogic();
+    }
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->GetPlaybackMismatchTick().has_value());
+
+    fs::remove(replayPath);
+}
+
+// Litter is not updated each tick, so a change made to it without marking it is only hashed when all entities are hashed
+// again at a keyframe. Both the recording and the playback make the same changes at the same ticks.
+static void ChangeLitterWithoutMarking(int32_t tick)
+{
+    if (tick == 20)
+    {
+        auto* litter = getGameState().entities.CreateEntity<Litter>();
+        ASSERT_NE(litter, nullptr);
+        litter->subType = Litter::Type::vomit;
+        litter->moveToAndUpdateSpatialIndex({ TileCoordsXY{ 16, 20 }.ToCoordsXY() + CoordsXY{ 16, 16 }, 0 });
+    }
+    else if (tick == 45)
+    {
+        for (auto* litter : EntityList<Litter>())
+        {
+            litter->subType = Litter::Type::emptyCan;
+        }
+    }
+}
+
+TEST(ReplayRecordTests, PlaybackThroughKeyframeAfterUnmarkedChange)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    replayManager->SetKeyframeInterval(50);
+
+    const auto replayPath = GetTemporaryReplayPath("openrct2_replay_unmarked_test.parkrep");
+    context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+    GameLoadInit();
+    ASSERT_TRUE(replayManager->StartRecording(replayPath));
+    for (int32_t i = 0; i < 100; i++)
+    {
+        ChangeLitterWithoutMarking(i);
+        gameStateUpdateLogic();
+    }
+    ASSERT_TRUE(replayManager->StopRecording());
+
+    // Play straight through the keyframe, without seeking to it.
+    replayManager->StartPlayback(replayPath);
+    for (int32_t i = 0; replayManager->IsReplaying() && !replayManager->IsPlaybackStateMismatching(); i++)
+    {
+        ChangeLitterWithoutMarking(i);
+        gameStateUpdateLogic();
+    }
+    ASSERT_FALSE(replayManager->IsReplaying());
+    ASSERT_FALSE(replayManager->GetPlaybackMismatchTick().has_value());
+
+    fs::remove(replayPath);
+}
+
+TEST(ReplayVerifyTests, VerifiesReplay)
+{
+    auto replays = GetReplayFiles();
+    ASSERT_FALSE(replays.empty());
+
+    const char* argv[] = { "openrct2", "replay", "verify", replays[0].filePath.c_str() };
+    EXPECT_EQ(CommandLineRun(argv, static_cast<int32_t>(std::size(argv))), EXITCODE_OK);
+
+    const auto missingPath = GetTemporaryReplayPath("openrct2_replay_missing.parkrep");
+    const char* missingArgv[] = { "openrct2", "replay", "verify", missingPath.c_str() };
+    EXPECT_EQ(CommandLineRun(missingArgv, static_cast<int32_t>(std::size(missingArgv))), EXITCODE_FAIL);
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
@@ -29,6 +29,7 @@
 #include <openrct2/rct2/RCT2.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/scenario/Scenario.h>
+#include <openrct2/scenario/ScenarioRepository.h>
 #include <openrct2/world/MapAnimation.h>
 #include <string>
 
@@ -284,3 +285,64 @@ TEST(SeaDecrypt, DecryptSea)
     };
     ASSERT_EQ(sha1, expected);
 }
+
+static void ExpectSameIndexEntry(const ScenarioIndexEntry& expected, const ScenarioIndexEntry& actual)
+{
+    EXPECT_EQ(expected.Category, actual.Category);
+    EXPECT_EQ(expected.SourceGame, actual.SourceGame);
+    EXPECT_EQ(expected.SourceIndex, actual.SourceIndex);
+    EXPECT_EQ(expected.ScenarioId, actual.ScenarioId);
+    EXPECT_EQ(expected.ObjectiveType, actual.ObjectiveType);
+    EXPECT_EQ(expected.ObjectiveArg1, actual.ObjectiveArg1);
+    EXPECT_EQ(expected.ObjectiveArg2, actual.ObjectiveArg2);
+    EXPECT_EQ(expected.ObjectiveArg3, actual.ObjectiveArg3);
+    EXPECT_EQ(expected.InternalName, actual.InternalName);
+    EXPECT_EQ(expected.Name, actual.Name);
+    EXPECT_EQ(expected.Details, actual.Details);
+}
+
+TEST(ScenarioMetadata, MatchesFullLoad)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    ASSERT_NE(context, nullptr);
+    ASSERT_TRUE(context->Initialise());
+
+    auto decrypted = DecryptSea(TestData::GetParkPath("volcania.sea"));
+    MemoryStream scenarioStream(decrypted.data(), decrypted.size(), MemoryAccess::read);
+
+    auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
+    auto loadResult = importer->LoadFromStream(&scenarioStream, true);
+    ScenarioIndexEntry expected{};
+    ASSERT_TRUE(importer->PopulateIndexEntry(&expected));
+
+    scenarioStream.SetPosition(0);
+    auto metadataImporter = ParkImporter::CreateS6(context->GetObjectRepository());
+    metadataImporter->LoadScenarioMetadata(&scenarioStream);
+    ScenarioIndexEntry actual{};
+    ASSERT_TRUE(metadataImporter->PopulateIndexEntry(&actual));
+    ExpectSameIndexEntry(expected, actual);
+
+    // Save the scenario as a park file, whose metadata is read without decompressing the map.
+    context->GetObjectManager().LoadObjects(loadResult.RequiredObjects);
+    MapAnimations::ClearAll();
+    importer->Import(getGameState());
+    GameInit(false);
+
+    MemoryStream parkStream;
+    ASSERT_TRUE(ExportSave(parkStream, context));
+
+    parkStream.SetPosition(0);
+    auto parkImporter = ParkImporter::CreateParkFile(context->GetObjectRepository());
+    parkImporter->LoadFromStream(&parkStream, true, true);
+    ASSERT_TRUE(parkImporter->PopulateIndexEntry(&expected));
+
+    parkStream.SetPosition(0);
+    auto parkMetadataImporter = ParkImporter::CreateParkFile(context->GetObjectRepository());
+    parkMetadataImporter->LoadScenarioMetadata(&parkStream);
+    ASSERT_TRUE(parkMetadataImporter->PopulateIndexEntry(&actual));
+    ExpectSameIndexEntry(expected, actual);
+    EXPECT_FALSE(actual.Name.empty());
+}
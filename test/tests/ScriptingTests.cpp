@@ -11,8 +11,11 @@
 #include <openrct2/Context.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/scripting/PluginBytecodeCache.h>
 #include <openrct2/scripting/ScriptEngine.h>
 #include <quickjs.h>
+#include <string>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -73,4 +76,102 @@ TEST_F(ScriptingTests, MultipleSubscribersToSameEventShouldNotCrash)
     hookEngine.Call(HookType::intervalTick, arg, false);
 }
 
+TEST_F(ScriptingTests, ActionHookFilterSkipsOtherActions)
+{
+    auto& scriptEngine = static_cast<ScriptEngine&>(_context->GetScriptEngine());
+
+    const char* pluginCode = R"(
+        registerPlugin({
+            name: 'test-plugin-action-filter',
+            version: '1.0.0',
+            authors: ['openrct2-test'],
+            type: 'remote',
+            licence: 'MIT',
+            targetApiVersion: 115,
+            main: function () {
+                context.subscribe('action.execute', function (e) {}, { actions: ['ridesetname', 'my-custom-action'] });
+            }
+        });
+    )";
+
+    scriptEngine.AddNetworkPlugin(pluginCode);
+    scriptEngine.LoadTransientPlugins();
+    scriptEngine.Tick();
+
+    auto& hookEngine = scriptEngine.GetHookEngine();
+    ASSERT_TRUE(hookEngine.HasSubscriptions(HookType::actionExecute));
+    EXPECT_TRUE(hookEngine.HasActionSubscriptions(HookType::actionExecute, GameCommand::SetRideName, {}));
+    EXPECT_TRUE(hookEngine.HasActionSubscriptions(HookType::actionExecute, GameCommand::Custom, "my-custom-action"));
+    EXPECT_FALSE(hookEngine.HasActionSubscriptions(HookType::actionExecute, GameCommand::PlacePath, {}));
+    EXPECT_FALSE(hookEngine.HasActionSubscriptions(HookType::actionExecute, GameCommand::Custom, "other-action"));
+
+    const auto statistics = hookEngine.GetStatistics();
+    ASSERT_EQ(statistics.size(), 1u);
+    EXPECT_EQ(statistics[0].Type, HookType::actionExecute);
+    EXPECT_EQ(statistics[0].Delivered, 0u);
+    EXPECT_EQ(statistics[0].Skipped, 2u);
+}
+
+TEST_F(ScriptingTests, BytecodeCacheReusesCompiledCode)
+{
+    auto& scriptEngine = static_cast<ScriptEngine&>(_context->GetScriptEngine());
+    JSContext* ctx = scriptEngine.GetContext();
+
+    const auto directory = fs::temp_directory_path() / "openrct2_bytecode_cache_test";
+    fs::remove_all(directory);
+    PluginBytecodeCache cache(directory.string());
+
+    auto run = [&](const std::string& code) {
+        JSValue function = cache.Compile(ctx, code, "test.js");
+        EXPECT_FALSE(JS_IsException(function));
+        JSValue result = JS_EvalFunction(ctx, function);
+        int32_t value = 0;
+        JS_ToInt32(ctx, &value, result);
+        JS_FreeValue(ctx, result);
+        return value;
+    };
+
+    EXPECT_EQ(run("6 * 7"), 42);
+    EXPECT_EQ(cache.GetNumHits(), 0u);
+    const auto entries = std::distance(fs::directory_iterator(directory), fs::directory_iterator());
+    EXPECT_EQ(entries, 1);
+
+    // The second run reads the entry, a changed script replaces it.
+    EXPECT_EQ(run("6 * 7"), 42);
+    EXPECT_EQ(cache.GetNumHits(), 1u);
+    EXPECT_EQ(run("6 * 8"), 48);
+    EXPECT_EQ(cache.GetNumHits(), 1u);
+    EXPECT_EQ(std::distance(fs::directory_iterator(directory), fs::directory_iterator()), 1);
+
+    fs::remove_all(directory);
+}
+
+TEST_F(ScriptingTests, BytecodeCacheKeepsRecentNetworkPlugins)
+{
+    auto& scriptEngine = static_cast<ScriptEngine&>(_context->GetScriptEngine());
+    JSContext* ctx = scriptEngine.GetContext();
+
+    const auto directory = fs::temp_directory_path() / "openrct2_bytecode_cache_network_test";
+    fs::remove_all(directory);
+    PluginBytecodeCache cache(directory.string(), 2);
+
+    // Network plugins have no file name, each version of their code gets an entry of its own.
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const auto code = std::to_string(i) + " + 1";
+        JSValue function = cache.Compile(ctx, code, "");
+        ASSERT_FALSE(JS_IsException(function));
+        JS_FreeValue(ctx, JS_EvalFunction(ctx, function));
+    }
+    EXPECT_EQ(std::distance(fs::directory_iterator(directory / "network"), fs::directory_iterator()), 2);
+
+    // The most recent one is still cached.
+    JSValue function = cache.Compile(ctx, "3 + 1", "");
+    ASSERT_FALSE(JS_IsException(function));
+    JS_FreeValue(ctx, JS_EvalFunction(ctx, function));
+    EXPECT_EQ(cache.GetNumHits(), 1u);
+
+    fs::remove_all(directory);
+}
+
 #endif
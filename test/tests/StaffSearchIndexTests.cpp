@@ -0,0 +1,272 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/actions/GameActionRunner.h>
+#include <openrct2/actions/footpath/FootpathAdditionPlaceAction.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
+#include <openrct2/object/PathAdditionEntry.h>
+#include <openrct2/world/Banner.h>
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/TileElementsView.h>
+#include <openrct2/world/TileInspector.h>
+#include <openrct2/world/tile_element/PathElement.h>
+#include <optional>
+#include <vector>
+
+using namespace OpenRCT2;
+
+/**
+ * Staff and guests skip areas without litter or bins by looking at the litter region counts of the entity registry and
+ * at the bin index of the footpaths. These tests check that both are kept up to date when the park changes.
+ */
+class StaffSearchIndexTests : public testing::Test
+{
+protected:
+    std::unique_ptr<IContext> _context;
+
+    void SetUp() override
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+
+        _context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+        GameLoadInit();
+    }
+
+    void TearDown() override
+    {
+        _context.reset();
+    }
+
+    static std::pair<CoordsXY, CoordsXY> GetTileArea(const TileCoordsXY& tile)
+    {
+        const auto minPos = tile.ToCoordsXY();
+        return { minPos, minPos + CoordsXY{ kCoordsXYStep - 1, kCoordsXYStep - 1 } };
+    }
+
+    static bool HasLitterOnTile(const TileCoordsXY& tile)
+    {
+        const auto [minPos, maxPos] = GetTileArea(tile);
+        return getGameState().entities.HasLitterInArea(minPos, maxPos);
+    }
+
+    // The region counts must say there is litter in exactly those regions where the tile lists hold some.
+    static void ExpectLitterRegionsMatchTileLists()
+    {
+        auto& entities = getGameState().entities;
+        constexpr int32_t kRegionTiles = 1 << kLitterRegionShift;
+        for (int32_t regionY = 0; regionY < kLitterRegionsPerSide; regionY++)
+        {
+            for (int32_t regionX = 0; regionX < kLitterRegionsPerSide; regionX++)
+            {
+                const TileCoordsXY minTile{ regionX * kRegionTiles, regionY * kRegionTiles };
+                const TileCoordsXY maxTile{ std::min<int32_t>(minTile.x + kRegionTiles, kMaximumMapSizeTechnical) - 1,
+                                            std::min<int32_t>(minTile.y + kRegionTiles, kMaximumMapSizeTechnical) - 1 };
+
+                bool hasLitter = false;
+                for (int32_t y = minTile.y; y <= maxTile.y && !hasLitter; y++)
+                {
+                    for (int32_t x = minTile.x; x <= maxTile.x && !hasLitter; x++)
+                    {
+                        const auto& tileList = entities.GetEntityTileList(TileCoordsXY{ x, y }.ToCoordsXY());
+                        hasLitter = std::any_of(tileList.begin(), tileList.end(), [&entities](EntityId id) {
+                            return entities.GetEntity<Litter>(id) != nullptr;
+                        });
+                    }
+                }
+
+                const auto minPos = minTile.ToCoordsXY();
+                const auto maxPos = GetTileArea(maxTile).second;
+                EXPECT_EQ(hasLitter, entities.HasLitterInArea(minPos, maxPos)) << "region " << regionX << ", " << regionY;
+            }
+        }
+    }
+
+    static bool TileHasBin(const TileCoordsXY& tile)
+    {
+        for (auto* pathElement : TileElementsView<PathElement>(tile.ToCoordsXY()))
+        {
+            auto* entry = pathElement->GetAdditionEntry();
+            if (pathElement->HasAddition() && entry != nullptr && (entry->flags & PATH_ADDITION_FLAG_IS_BIN))
+                return true;
+        }
+        return false;
+    }
+
+    // The index may hold tiles without bins, but must never miss a tile with a bin.
+    static void ExpectBinIndexCoversBins()
+    {
+        const auto mapSize = getGameState().mapSize;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                const TileCoordsXY tile{ x, y };
+                if (TileHasBin(tile))
+                {
+                    EXPECT_TRUE(FootpathBinIndexMayContainBin(tile.ToCoordsXY())) << "tile " << x << ", " << y;
+                }
+            }
+        }
+    }
+
+    // Finds flat footpaths with a free edge and without an addition on tiles that have no bin, where a bin can be added.
+    static std::vector<CoordsXYZ> FindFreeFootpaths()
+    {
+        std::vector<CoordsXYZ> result;
+        const auto mapSize = getGameState().mapSize;
+        for (int32_t y = 1; y < mapSize.y - 1; y++)
+        {
+            for (int32_t x = 1; x < mapSize.x - 1; x++)
+            {
+                const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                if (TileHasBin({ x, y }))
+                    continue;
+
+                for (auto* pathElement : TileElementsView<PathElement>(loc))
+                {
+                    if (!pathElement->HasAddition() && !pathElement->IsSloped() && !pathElement->IsQueue()
+                        && pathElement->GetEdges() != 0x0F && !pathElement->IsLevelCrossing(loc))
+                    {
+                        result.emplace_back(loc, pathElement->getBaseZ());
+                        break;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    // Returns a copy of a footpath element with a bin, as the tile inspector copies it.
+    static std::optional<TileElement> FindBin()
+    {
+        const auto mapSize = getGameState().mapSize;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                for (auto* tileElement : TileElementsView(TileCoordsXY{ x, y }))
+                {
+                    auto* pathElement = tileElement->asPath();
+                    if (pathElement == nullptr || !pathElement->HasAddition())
+                        continue;
+
+                    auto* entry = pathElement->GetAdditionEntry();
+                    if (entry != nullptr && (entry->flags & PATH_ADDITION_FLAG_IS_BIN))
+                        return *tileElement;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+TEST_F(StaffSearchIndexTests, LitterRegionCountsFollowLitter)
+{
+    auto& entities = getGameState().entities;
+    ExpectLitterRegionsMatchTileLists();
+
+    std::vector<Litter*> existingLitter;
+    for (auto* litter : EntityList<Litter>())
+        existingLitter.push_back(litter);
+    for (auto* litter : existingLitter)
+        entities.EntityRemove(litter);
+
+    const CoordsXY mapMax = { getGameState().mapSize.x * kCoordsXYStep - 1, getGameState().mapSize.y * kCoordsXYStep - 1 };
+    EXPECT_FALSE(entities.HasLitterInArea({ 0, 0 }, mapMax));
+
+    // Regions are 8 tiles wide, so these tiles lie on either side of a region boundary.
+    const TileCoordsXY firstTile{ 15, 20 };
+    const TileCoordsXY secondTile{ 16, 20 };
+    const auto tileCentre = CoordsXY{ kCoordsXYHalfTile, kCoordsXYHalfTile };
+
+    auto* litter = entities.CreateEntity<Litter>();
+    ASSERT_NE(litter, nullptr);
+    litter->moveToAndUpdateSpatialIndex({ firstTile.ToCoordsXY() + tileCentre, 0 });
+    EXPECT_TRUE(HasLitterOnTile(firstTile));
+    EXPECT_FALSE(HasLitterOnTile(secondTile));
+    ExpectLitterRegionsMatchTileLists();
+
+    litter->moveToAndUpdateSpatialIndex({ secondTile.ToCoordsXY() + tileCentre, 0 });
+    EXPECT_FALSE(HasLitterOnTile(firstTile));
+    EXPECT_TRUE(HasLitterOnTile(secondTile));
+    ExpectLitterRegionsMatchTileLists();
+
+    // Litter that is moved off the map is only found by areas which reach outside of it.
+    litter->moveToAndUpdateSpatialIndex({ kLocationNull, 0, 0 });
+    EXPECT_FALSE(entities.HasLitterInArea({ 0, 0 }, mapMax));
+    const CoordsXY technicalMax = { kMaximumMapSizeTechnical * kCoordsXYStep, kMaximumMapSizeTechnical * kCoordsXYStep };
+    EXPECT_TRUE(entities.HasLitterInArea({ 0, 0 }, technicalMax));
+
+    litter->moveToAndUpdateSpatialIndex({ firstTile.ToCoordsXY() + tileCentre, 0 });
+    EXPECT_TRUE(HasLitterOnTile(firstTile));
+
+    entities.EntityRemove(litter);
+    EXPECT_FALSE(HasLitterOnTile(firstTile));
+    EXPECT_FALSE(entities.HasLitterInArea({ 0, 0 }, technicalMax));
+    ExpectLitterRegionsMatchTileLists();
+}
+
+TEST_F(StaffSearchIndexTests, BinIndexFollowsBins)
+{
+    auto& gameState = getGameState();
+    gameState.cheats.sandboxMode = true;
+    gameState.park.flags |= PARK_FLAGS_NO_MONEY;
+    ExpectBinIndexCoversBins();
+
+    const auto binElement = FindBin();
+    ASSERT_TRUE(binElement.has_value());
+    const auto binEntryIndex = binElement->asPath()->GetAdditionEntryIndex();
+
+    // The index is exact right after it is built, so tiles without a bin are not in it.
+    const auto freeFootpaths = FindFreeFootpaths();
+    ASSERT_GE(freeFootpaths.size(), 2u);
+    const auto placeLoc = freeFootpaths[0];
+    const auto pasteLoc = freeFootpaths[1];
+    ASSERT_FALSE(FootpathBinIndexMayContainBin(placeLoc));
+    ASSERT_FALSE(FootpathBinIndexMayContainBin(pasteLoc));
+
+    // Adding a bin to a footpath.
+    auto action = GameActions::FootpathAdditionPlaceAction(placeLoc, binEntryIndex);
+    auto result = GameActions::Execute(&action, gameState);
+    ASSERT_EQ(result.error, GameActions::Status::ok);
+    EXPECT_TRUE(FootpathBinIndexMayContainBin(placeLoc));
+
+    // Pasting a footpath with a bin in the tile inspector.
+    result = TileInspector::PasteElementAt(pasteLoc, *binElement, Banner{}, true);
+    ASSERT_EQ(result.error, GameActions::Status::ok);
+    EXPECT_TRUE(FootpathBinIndexMayContainBin(pasteLoc));
+    ExpectBinIndexCoversBins();
+
+    // Shifting the map replaces all tile elements, the bins are found at their new tiles.
+    ShiftMap({ 3, 2 });
+    ExpectBinIndexCoversBins();
+
+    // As does loading a park, which leaves no bins on the tiles where they were added.
+    _context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+    GameLoadInit();
+    EXPECT_FALSE(FootpathBinIndexMayContainBin(placeLoc));
+    EXPECT_FALSE(FootpathBinIndexMayContainBin(pasteLoc));
+    ExpectBinIndexCoversBins();
+}
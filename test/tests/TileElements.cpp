@@ -18,6 +18,7 @@
 #include <openrct2/world/Map.h>
 #include <openrct2/world/tile_element/EntranceElement.h>
 #include <openrct2/world/tile_element/PathElement.h>
+#include <openrct2/world/tile_element/TileElement.h>
 #include <openrct2/world/tile_element/TrackElement.h>
 
 using namespace OpenRCT2;
@@ -173,3 +174,45 @@ TEST_F(TileElementWantsFootpathConnection, MapEdge)
     // The tile in the -X direction is a normal tile and should not be marked as an edge
     EXPECT_FALSE(edges & (1 << 2));
 }
+
+// Loads the same park as the footpath connection tests.
+class TileElementRegionStorage : public TileElementWantsFootpathConnection
+{
+protected:
+    static size_t CountElementsOnTile(const TileCoordsXY& tilePos)
+    {
+        size_t count = 0;
+        const auto* element = MapGetFirstElementAt(tilePos);
+        do
+        {
+            count++;
+        } while (!(element++)->isLastForTile());
+        return count;
+    }
+};
+
+TEST_F(TileElementRegionStorage, InsertOnlyMovesOwnRegion)
+{
+    constexpr size_t kNumInserts = 512;
+    const auto tilePos = TileCoordsXY{ 40, 40 };
+    const auto otherTilePos = TileCoordsXY{ 1, 1 };
+
+    const auto* otherTileElement = MapGetFirstElementAt(otherTilePos);
+    const auto numElementsInUse = GetTileElementCount();
+    const auto numSavedElements = GetReorganisedTileElementsWithoutGhosts().size();
+    const auto numElementsOnTile = CountElementsOnTile(tilePos);
+
+    // Enough elements to run out of space in the region several times over
+    for (size_t i = 0; i < kNumInserts; i++)
+    {
+        auto* element = TileElementInsert(CoordsXYZ{ tilePos.ToCoordsXY(), 200 * kCoordsZStep }, 0b1111, TileElementType::Wall);
+        ASSERT_NE(element, nullptr);
+    }
+
+    // Tiles in other regions are not moved
+    EXPECT_EQ(MapGetFirstElementAt(otherTilePos), otherTileElement);
+
+    EXPECT_EQ(CountElementsOnTile(tilePos), numElementsOnTile + kNumInserts);
+    EXPECT_EQ(GetTileElementCount(), numElementsInUse + kNumInserts);
+    EXPECT_EQ(GetReorganisedTileElementsWithoutGhosts().size(), numSavedElements + kNumInserts);
+}